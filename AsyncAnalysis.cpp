@@ -0,0 +1,145 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file AsyncAnalysis.cpp
+ * @brief This file contains the implementation of the AnalysisScheduler and the asynchronous
+ *        analysis operations.
+ *
+ * Everything is compiled only when coroutines are available, so the file can sit in a C++17
+ * build of the library without breaking it.
+ */
+
+#if defined(__cpp_impl_coroutine)
+
+#include "AsyncAnalysis.hpp"
+#include "Perft.hpp"
+
+/**
+ * @brief Constructor. Starts both pools.
+ * @param computeThreads The number of compute threads, 0 for every hardware thread
+ * @param ioThreads The number of threads for blocking probes, at least 1
+ */
+AnalysisScheduler::AnalysisScheduler(unsigned computeThreads, unsigned ioThreads) {
+    if (computeThreads == 0) {
+        computeThreads = std::thread::hardware_concurrency();
+    }
+    start(compute_, computeThreads > 0 ? computeThreads : 1);
+    start(io_, ioThreads > 0 ? ioThreads : 1);
+}
+
+/**
+ * @brief Destructor. Lets the threads finish the coroutines already queued, then joins them.
+ */
+AnalysisScheduler::~AnalysisScheduler() {
+    stop(io_);
+    stop(compute_);
+}
+
+/**
+ * @return An awaitable that continues the coroutine on a compute thread
+ */
+AnalysisScheduler::Awaiter AnalysisScheduler::schedule() {
+    return Awaiter(compute_);
+}
+
+/**
+ * @return An awaitable that continues the coroutine on an I/O thread, for calls that block
+ */
+AnalysisScheduler::Awaiter AnalysisScheduler::offload() {
+    return Awaiter(io_);
+}
+
+void AnalysisScheduler::post(Pool &pool, std::coroutine_handle<> handle) {
+    {
+        std::lock_guard<std::mutex> guard(pool.lock);
+        pool.queue.push_back(handle);
+    }
+    pool.ready.notify_one();
+}
+
+void AnalysisScheduler::run(Pool &pool) {
+    for (;;) {
+        std::coroutine_handle<> handle;
+        {
+            std::unique_lock<std::mutex> guard(pool.lock);
+            pool.ready.wait(guard, [&pool] { return pool.stopping || !pool.queue.empty(); });
+            if (pool.queue.empty()) {
+                return;
+            }
+            handle = pool.queue.front();
+            pool.queue.pop_front();
+        }
+        handle.resume();
+    }
+}
+
+void AnalysisScheduler::start(Pool &pool, unsigned threads) {
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.threads.emplace_back(&AnalysisScheduler::run, std::ref(pool));
+    }
+}
+
+void AnalysisScheduler::stop(Pool &pool) {
+    {
+        std::lock_guard<std::mutex> guard(pool.lock);
+        pool.stopping = true;
+    }
+    pool.ready.notify_all();
+    for (std::thread &thread : pool.threads) {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Runs a single-threaded MCTS search on a compute thread.
+ */
+Task<MctsEngine::Report> AsyncAnalysis::search(AnalysisScheduler &scheduler, Board board,
+                                               MctsEngine::Options options) {
+    co_await scheduler.schedule();
+    options.threads = 1;
+    MctsEngine engine(options);
+    co_return engine.search(board);
+}
+
+/**
+ * @brief Counts perft leaves on a compute thread.
+ */
+Task<std::uint64_t> AsyncAnalysis::perft(AnalysisScheduler &scheduler, Board board, int depth) {
+    co_await scheduler.schedule();
+    co_return Perft::count(board, depth);
+}
+
+/**
+ * @brief Runs a blocking probe on an I/O thread, then continues on a compute thread.
+ */
+Task<AsyncAnalysis::ProbeResult> AsyncAnalysis::probe(AnalysisScheduler &scheduler, Board board, Prober prober) {
+    co_await scheduler.offload();
+    ProbeResult result;
+    result.value = 0;
+    result.found = prober(board, result.value);
+    co_await scheduler.schedule();
+    co_return result;
+}
+
+/**
+ * @brief Probes first and only searches when the probe has no answer.
+ */
+Task<AsyncAnalysis::Analysis> AsyncAnalysis::analyse(AnalysisScheduler &scheduler, Board board,
+                                                     MctsEngine::Options options, Prober prober) {
+    Analysis analysis;
+    analysis.fromProbe = false;
+    analysis.probe.found = false;
+    analysis.probe.value = 0;
+    analysis.search = MctsEngine::Report();
+    if (prober) {
+        analysis.probe = co_await probe(scheduler, board, prober);
+        if (analysis.probe.found) {
+            analysis.fromProbe = true;
+            co_return analysis;
+        }
+    }
+    analysis.search = co_await search(scheduler, board, options);
+    co_return analysis;
+}
+
+#endif
@@ -0,0 +1,426 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file AsyncAnalysis.hpp
+ * @brief This file declares the coroutine based asynchronous analysis API: the Task type,
+ *        the AnalysisScheduler that runs tasks on fixed thread pools, and the analysis
+ *        operations (search, perft, probe) written as tasks.
+ *
+ * A Task is a lazily started coroutine. Awaiting it runs it and resumes the awaiting coroutine
+ * when it finishes, without a thread ever blocking in between. The scheduler owns two fixed
+ * pools: compute threads for search work and a few I/O threads for probes that block (disk or
+ * network backed tables). A task hops between them with co_await scheduler.schedule() and
+ * co_await scheduler.offload(), so thousands of analyses can be in flight on a handful of
+ * threads and a slow probe never holds a compute thread.
+ *
+ * Requires C++20 (-std=c++20); the rest of the library still builds as C++17.
+ */
+
+#ifndef CHESS_ASYNC_ANALYSIS_HPP
+#define CHESS_ASYNC_ANALYSIS_HPP
+
+#if !defined(__cpp_impl_coroutine)
+#error "AsyncAnalysis.hpp needs C++20 coroutines (-std=c++20)"
+#endif
+
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Board.hpp"
+#include "MctsEngine.hpp"
+
+template <typename T>
+class Task;
+
+namespace AsyncDetail {
+
+    // When a task finishes, control passes straight to whoever awaited it
+    struct FinalAwaiter {
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept {
+            std::coroutine_handle<> continuation = handle.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {
+        }
+    };
+
+    struct PromiseBase {
+        std::coroutine_handle<> continuation;
+        std::exception_ptr error;
+
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        FinalAwaiter final_suspend() const noexcept {
+            return {};
+        }
+
+        void unhandled_exception() {
+            error = std::current_exception();
+        }
+    };
+
+    template <typename T>
+    struct Promise : PromiseBase {
+        std::optional<T> value;
+
+        Task<T> get_return_object();
+
+        void return_value(T result) {
+            value.emplace(std::move(result));
+        }
+
+        T take() {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return std::move(*value);
+        }
+    };
+
+    template <>
+    struct Promise<void> : PromiseBase {
+        Task<void> get_return_object();
+
+        void return_void() const noexcept {
+        }
+
+        void take() const {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    };
+
+    // A fire-and-forget coroutine, used to drive tasks from ordinary threads
+    struct Detached {
+        struct promise_type {
+            Detached get_return_object() const noexcept {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() const noexcept {
+                return {};
+            }
+
+            std::suspend_never final_suspend() const noexcept {
+                return {};
+            }
+
+            void return_void() const noexcept {
+            }
+
+            void unhandled_exception() const noexcept {
+                std::terminate();
+            }
+        };
+    };
+
+    // Counts finished tasks so an ordinary thread can sleep until all of them are done
+    class Latch {
+    private:
+        std::mutex lock_;
+        std::condition_variable done_;
+        std::size_t pending_;
+
+    public:
+        explicit Latch(std::size_t pending) : pending_(pending) {
+        }
+
+        void countDown() {
+            std::lock_guard<std::mutex> guard(lock_);
+            if (--pending_ == 0) {
+                done_.notify_all();
+            }
+        }
+
+        void wait() {
+            std::unique_lock<std::mutex> guard(lock_);
+            done_.wait(guard, [this] { return pending_ == 0; });
+        }
+    };
+
+    template <typename T>
+    struct Outcome {
+        std::optional<T> value;
+        std::exception_ptr error;
+
+        T take() {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return std::move(*value);
+        }
+    };
+
+    template <>
+    struct Outcome<void> {
+        std::exception_ptr error;
+
+        void take() const {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    };
+}
+
+/**
+ * @brief A lazily started coroutine producing a T. Move-only; awaiting it runs it to completion
+ *        and yields its result (or rethrows its exception).
+ */
+template <typename T>
+class Task {
+public:
+    using promise_type = AsyncDetail::Promise<T>;
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+public:
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {
+    }
+
+    Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, {})) {
+    }
+
+    Task &operator=(Task &&other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    Task(const Task &) = delete;
+    Task &operator=(const Task &) = delete;
+
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) noexcept {
+        handle_.promise().continuation = caller;
+        return handle_;
+    }
+
+    T await_resume() {
+        return handle_.promise().take();
+    }
+};
+
+template <typename T>
+Task<T> AsyncDetail::Promise<T>::get_return_object() {
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> AsyncDetail::Promise<void>::get_return_object() {
+    return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+class AnalysisScheduler {
+private:
+    struct Pool {
+        std::mutex lock;
+        std::condition_variable ready;
+        std::deque<std::coroutine_handle<>> queue;
+        std::vector<std::thread> threads;
+        bool stopping = false;
+    };
+
+    Pool compute_;
+    Pool io_;
+
+public:
+    /**
+     * @brief The awaitable returned by schedule() and offload(): suspends the coroutine and
+     *        resumes it on one of the pool's threads.
+     */
+    class Awaiter {
+    private:
+        Pool &pool_;
+
+    public:
+        explicit Awaiter(Pool &pool) : pool_(pool) {
+        }
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle) const {
+            AnalysisScheduler::post(pool_, handle);
+        }
+
+        void await_resume() const noexcept {
+        }
+    };
+
+    /**
+     * @brief Constructor. Starts both pools.
+     * @param computeThreads The number of compute threads, 0 for every hardware thread
+     * @param ioThreads The number of threads for blocking probes, at least 1
+     */
+    explicit AnalysisScheduler(unsigned computeThreads = 0, unsigned ioThreads = 4);
+
+    /**
+     * @brief Destructor. Lets the threads finish the coroutines already queued, then joins them.
+     *        Every task must have completed (eg. through wait()) before the scheduler is destroyed.
+     */
+    ~AnalysisScheduler();
+
+    AnalysisScheduler(const AnalysisScheduler &) = delete;
+    AnalysisScheduler &operator=(const AnalysisScheduler &) = delete;
+
+    /**
+     * @return An awaitable that continues the coroutine on a compute thread
+     */
+    Awaiter schedule();
+
+    /**
+     * @return An awaitable that continues the coroutine on an I/O thread, for calls that block
+     */
+    Awaiter offload();
+
+    /**
+     * @brief Runs a task and blocks the calling (non-pool) thread until it finishes.
+     * @param task The task to run
+     * @return Its result; its exception is rethrown here
+     */
+    template <typename T>
+    T wait(Task<T> task) {
+        AsyncDetail::Latch latch(1);
+        AsyncDetail::Outcome<T> outcome;
+        drive(task, outcome, latch);
+        latch.wait();
+        return outcome.take();
+    }
+
+    /**
+     * @brief Runs many tasks concurrently and blocks the calling (non-pool) thread until all finish.
+     * @param tasks The tasks to run
+     * @return Their results, in the order of the tasks; the first exception found is rethrown
+     */
+    template <typename T>
+    std::vector<T> waitAll(std::vector<Task<T>> tasks) {
+        AsyncDetail::Latch latch(tasks.size());
+        std::vector<AsyncDetail::Outcome<T>> outcomes(tasks.size());
+        for (std::size_t i = 0; i < tasks.size(); ++i) {
+            drive(tasks[i], outcomes[i], latch);
+        }
+        latch.wait();
+        std::vector<T> results;
+        results.reserve(outcomes.size());
+        for (AsyncDetail::Outcome<T> &outcome : outcomes) {
+            results.push_back(outcome.take());
+        }
+        return results;
+    }
+
+private:
+    static void post(Pool &pool, std::coroutine_handle<> handle);
+    static void run(Pool &pool);
+    static void start(Pool &pool, unsigned threads);
+    static void stop(Pool &pool);
+
+    // Starts the task on the calling thread; the first co_await inside it decides where it continues
+    template <typename T>
+    static AsyncDetail::Detached drive(Task<T> &task, AsyncDetail::Outcome<T> &outcome, AsyncDetail::Latch &latch) {
+        try {
+            if constexpr (std::is_void_v<T>) {
+                co_await task;
+            } else {
+                outcome.value.emplace(co_await task);
+            }
+        } catch (...) {
+            outcome.error = std::current_exception();
+        }
+        latch.countDown();
+    }
+};
+
+namespace AsyncAnalysis {
+
+    /**
+     * @brief A blocking probe of an external table (eg. an endgame tablebase on disk).
+     *        It returns true and sets the value if the position is in the table.
+     */
+    typedef std::function<bool(const Board &, int &)> Prober;
+
+    struct ProbeResult {
+        bool found;
+        int value;
+    };
+
+    struct Analysis {
+        bool fromProbe;                 // True if the probe answered and no search was run
+        ProbeResult probe;
+        MctsEngine::Report search;      // Only filled when fromProbe is false
+    };
+
+    /**
+     * @brief Runs a single-threaded MCTS search on a compute thread.
+     * @param scheduler The scheduler to run on
+     * @param board The position, copied into the task
+     * @param options The search options; threads is forced to 1, the pool provides the parallelism
+     * @return The search report
+     */
+    Task<MctsEngine::Report> search(AnalysisScheduler &scheduler, Board board, MctsEngine::Options options);
+
+    /**
+     * @brief Counts perft leaves on a compute thread.
+     * @param scheduler The scheduler to run on
+     * @param board The position, copied into the task
+     * @param depth The depth to count to
+     * @return The number of leaves
+     */
+    Task<std::uint64_t> perft(AnalysisScheduler &scheduler, Board board, int depth);
+
+    /**
+     * @brief Runs a blocking probe on an I/O thread, then continues on a compute thread.
+     * @param scheduler The scheduler to run on
+     * @param board The position, copied into the task
+     * @param prober The probe to call
+     * @return Whether the probe found the position, and its value
+     */
+    Task<ProbeResult> probe(AnalysisScheduler &scheduler, Board board, Prober prober);
+
+    /**
+     * @brief Probes first and only searches when the probe has no answer.
+     * @param scheduler The scheduler to run on
+     * @param board The position, copied into the task
+     * @param options The search options, see search()
+     * @param prober The probe to call, or an empty function to always search
+     * @return The probe result or the search report
+     */
+    Task<Analysis> analyse(AnalysisScheduler &scheduler, Board board, MctsEngine::Options options, Prober prober);
+}
+
+
+#endif //CHESS_ASYNC_ANALYSIS_HPP
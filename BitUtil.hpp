@@ -0,0 +1,107 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file BitUtil.hpp
+ * @brief Small bit-twiddling helpers shared by the bitmap and bitboard code.
+ *
+ * The helpers wrap the compiler intrinsics for population count and bit scanning so the
+ * rest of the code does not have to care which compiler it is built with.
+ */
+
+#ifndef CHESS_BIT_UTIL_HPP
+#define CHESS_BIT_UTIL_HPP
+
+
+#include <cstdint>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace BitUtil {
+
+    /**
+     * @brief Counts the set bits of a 64 bit word.
+     * @param word The word to count
+     * @return The number of bits set in word
+     */
+    inline int popcount(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(word);
+#else
+        int count = 0;
+        while (word) {
+            word &= word - 1;
+            ++count;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * @brief Finds the index of the least significant set bit.
+     * @param word A NON-ZERO 64 bit word
+     * @return The 0-indexed position of the lowest set bit
+     */
+    inline int lsb(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(word);
+#else
+        int index = 0;
+        while (!(word & 1)) {
+            word >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    /**
+     * @brief Finds the index of the most significant set bit.
+     * @param word A NON-ZERO 64 bit word
+     * @return The 0-indexed position of the highest set bit
+     */
+    inline int msb(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return 63 - __builtin_clzll(word);
+#else
+        int index = 63;
+        while (!(word >> index)) {
+            --index;
+        }
+        return index;
+#endif
+    }
+
+    /**
+     * @brief Removes the least significant set bit and returns its index.
+     * @param word A reference to a NON-ZERO 64 bit word
+     * @post The lowest set bit of word is cleared
+     * @return The 0-indexed position of the bit that was cleared
+     */
+    inline int popLsb(std::uint64_t &word) {
+        int index = lsb(word);
+        word &= word - 1;
+        return index;
+    }
+
+    /**
+     * @brief Finds the n-th set bit of a word (counting from the least significant bit).
+     *     Uses the BMI2 PDEP instruction when the build enables it.
+     * @param word A 64 bit word with more than n bits set
+     * @param n The 0-indexed rank of the bit to find
+     * @return The 0-indexed position of that bit
+     */
+    inline int selectBit(std::uint64_t word, int n) {
+#if defined(__BMI2__)
+        return lsb(_pdep_u64(std::uint64_t(1) << n, word));
+#else
+        for (int i = 0; i < n; ++i) {
+            word &= word - 1;
+        }
+        return lsb(word);
+#endif
+    }
+}
+
+
+#endif //CHESS_BIT_UTIL_HPP
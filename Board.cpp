@@ -0,0 +1,574 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Board.cpp
+ * @brief This file contains the implementation of the Move, MoveList and Board classes.
+ */
+
+#include "BitUtil.hpp"
+#include "Board.hpp"
+#include "BoardTables.hpp"
+#include "Random.hpp"
+
+namespace {
+    const int N = ChessPiece::BOARD_LENGTH;
+    const Bitboard FIRST_COLUMN = 0x0101010101010101ULL;
+    const Bitboard LAST_COLUMN = FIRST_COLUMN << (N - 1);
+    const Bitboard FIRST_ROW = 0xFFULL;
+    const Bitboard LAST_ROW = FIRST_ROW << (N * (N - 1));
+
+    inline Bitboard bit(int square) {
+        return Bitboard(1) << square;
+    }
+
+    struct ZobristKeys {
+        std::uint64_t piece[2][3][Board::SQUARES];
+        std::uint64_t movingUp[Board::SQUARES];
+        std::uint64_t doubleJump[Board::SQUARES];
+        std::uint64_t castle[Board::SQUARES];
+        std::uint64_t blackToMove;
+
+        // Evaluated by the compiler, so the keys are read-only data with no startup cost
+        constexpr ZobristKeys() : piece{}, movingUp{}, doubleJump{}, castle{}, blackToMove(0) {
+            Random random(0x5A0B1257ULL);
+            for (auto &side : piece) {
+                for (auto &kind : side) {
+                    for (std::uint64_t &key : kind) {
+                        key = random.next();
+                    }
+                }
+            }
+            for (int square = 0; square < Board::SQUARES; ++square) {
+                movingUp[square] = random.next();
+                doubleJump[square] = random.next();
+                castle[square] = random.next();
+            }
+            blackToMove = random.next();
+        }
+    };
+
+    constexpr ZobristKeys ZOBRIST;
+
+    inline const ZobristKeys &zobrist() {
+        return ZOBRIST;
+    }
+
+    // Castle counts are unbounded, so the count is mixed into the square's key instead of
+    // looking up one key per count
+    inline std::uint64_t castleKey(int square, std::int32_t castleMoves) {
+        std::uint64_t z = zobrist().castle[square] + static_cast<std::uint64_t>(castleMoves) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // The key of one piece with all of its state
+    inline std::uint64_t pieceKey(int square, int side, PieceKind kind, bool movingUp, bool doubleJump,
+                                  std::int32_t castleMoves) {
+        const ZobristKeys &keys = zobrist();
+        std::uint64_t key = keys.piece[side][static_cast<int>(kind)][square];
+        if (movingUp) {
+            key ^= keys.movingUp[square];
+        }
+        if (doubleJump) {
+            key ^= keys.doubleJump[square];
+        }
+        if (castleMoves != 0) {
+            key ^= castleKey(square, castleMoves);
+        }
+        return key;
+    }
+
+    // Adds one move per target square; each pawn target is reached from a fixed offset
+    void addPawnTargets(MoveList &moves, Bitboard targets, int offset, Bitboard promotionRow, Move::Flag flag) {
+        while (targets) {
+            int to = BitUtil::popLsb(targets);
+            Move::Flag actual = (bit(to) & promotionRow) ? Move::PROMOTION : flag;
+            moves.add(Move(to - offset, to, actual));
+        }
+    }
+}
+
+/**
+ * @brief Default Constructor. Creates the null move (a1 to a1), which is never legal.
+ */
+Move::Move() : data_(0) {
+}
+
+/**
+ * @brief Parameterized constructor.
+ * @param from The square the moving piece starts on
+ * @param to The square it ends on (for a castle, the square of the partner piece)
+ * @param flag The kind of move, one of Move::Flag
+ */
+Move::Move(int from, int to, Flag flag)
+        : data_(static_cast<std::uint16_t>(from | (to << 6) | (flag << 12))) {
+}
+
+int Move::from() const {
+    return data_ & 63;
+}
+
+int Move::to() const {
+    return (data_ >> 6) & 63;
+}
+
+Move::Flag Move::flag() const {
+    return static_cast<Flag>(data_ >> 12);
+}
+
+std::uint16_t Move::raw() const {
+    return data_;
+}
+
+Move Move::fromRaw(std::uint16_t raw) {
+    Move move;
+    move.data_ = raw;
+    return move;
+}
+
+bool Move::operator==(const Move &other) const {
+    return data_ == other.data_;
+}
+
+bool Move::operator!=(const Move &other) const {
+    return data_ != other.data_;
+}
+
+
+MoveList::MoveList() : size_(0) {
+}
+
+void MoveList::add(const Move &move) {
+    moves_[size_++] = move.raw();
+}
+
+int MoveList::size() const {
+    return size_;
+}
+
+Move MoveList::operator[](int index) const {
+    return Move::fromRaw(moves_[index]);
+}
+
+
+/**
+ * @brief Default Constructor. Creates an empty board with WHITE to move.
+ */
+Board::Board() {
+    clear();
+}
+
+/**
+ * @brief Removes every piece and resets the side to move and ply counter.
+ */
+void Board::clear() {
+    for (int side = 0; side < 2; ++side) {
+        by_side_[side] = 0;
+        for (int kind = 0; kind < 3; ++kind) {
+            by_kind_[side][kind] = 0;
+        }
+    }
+    moving_up_ = 0;
+    double_jump_ = 0;
+    for (int square = 0; square < SQUARES; ++square) {
+        kind_[square] = NO_PIECE;
+        castle_moves_[square] = 0;
+    }
+    side_to_move_ = WHITE;
+    plies_since_progress_ = 0;
+    key_ = 0;
+}
+
+/**
+ * @brief Places a piece on the board.
+ * @param piece The piece to place. Overloads keep the pawn and rook specific state.
+ * @return True if the piece was placed. False if its color is neither WHITE nor BLACK,
+ *         it is not on the board, or its square is already taken (nothing is placed then).
+ */
+bool Board::place(const ChessPiece &piece) {
+    return place(PieceRecord::fromPiece(piece));
+}
+
+bool Board::place(const Pawn &pawn) {
+    return place(PieceRecord::fromPawn(pawn));
+}
+
+bool Board::place(const Rook &rook) {
+    return place(PieceRecord::fromRook(rook));
+}
+
+bool Board::place(const PieceRecord &record) {
+    // Records may come from outside the library, so every field is checked before it is used
+    if (!record.isValid() || record.color > BLACK || !record.isOnBoard()
+        || (record.kind == PieceKind::ROOK && record.castleMovesLeft < 0)) {
+        return false;
+    }
+    int square = record.row * N + record.column;
+    if (kind_[square] != NO_PIECE) {
+        return false;
+    }
+    put(square, record.color, record.kind, record.movingUp,
+        record.kind == PieceKind::PAWN && record.doubleJumpable,
+        record.kind == PieceKind::ROOK ? record.castleMovesLeft : 0);
+    return true;
+}
+
+/**
+ * @return The pieces on the board, in square order
+ */
+std::vector<PieceRecord> Board::pieces() const {
+    std::vector<PieceRecord> result;
+    Bitboard all = occupied();
+    while (all) {
+        int square = BitUtil::popLsb(all);
+        PieceRecord record;
+        record.kind = static_cast<PieceKind>(kind_[square]);
+        record.row = static_cast<std::int8_t>(square / N);
+        record.column = static_cast<std::int8_t>(square % N);
+        record.movingUp = (moving_up_ & bit(square)) != 0;
+        record.doubleJumpable = (double_jump_ & bit(square)) != 0;
+        record.color = static_cast<std::uint16_t>(sideAt(square));
+        record.castleMovesLeft = castle_moves_[square];
+        result.push_back(record);
+    }
+    return result;
+}
+
+int Board::sideToMove() const {
+    return side_to_move_;
+}
+
+void Board::setSideToMove(int side) {
+    if (side != side_to_move_) {
+        key_ ^= zobrist().blackToMove;
+    }
+    side_to_move_ = side;
+}
+
+int Board::pliesSinceProgress() const {
+    return plies_since_progress_;
+}
+
+/**
+ * @brief Gets the Zobrist key of the position. It covers every piece with its side, kind,
+ *        direction, double jump flag and castle moves, plus the side to move, and is kept
+ *        up to date incrementally by every change to the board.
+ * @return The 64 bit key
+ */
+std::uint64_t Board::key() const {
+    return key_;
+}
+
+Bitboard Board::pieces(int side, PieceKind kind) const {
+    return by_kind_[side][static_cast<int>(kind)];
+}
+
+Bitboard Board::occupied(int side) const {
+    return by_side_[side];
+}
+
+Bitboard Board::occupied() const {
+    return by_side_[WHITE] | by_side_[BLACK];
+}
+
+Bitboard Board::movingUp() const {
+    return moving_up_;
+}
+
+Bitboard Board::doubleJumpers() const {
+    return double_jump_;
+}
+
+int Board::kindAt(int square) const {
+    return kind_[square];
+}
+
+int Board::sideAt(int square) const {
+    if (by_side_[WHITE] & bit(square)) {
+        return WHITE;
+    }
+    if (by_side_[BLACK] & bit(square)) {
+        return BLACK;
+    }
+    return NO_PIECE;
+}
+
+int Board::castleMovesAt(int square) const {
+    return castle_moves_[square];
+}
+
+/**
+ * @brief Generates every legal move for the side to move.
+ * @param moves A reference to the list that receives the moves (it is not cleared first)
+ */
+void Board::generateMoves(MoveList &moves) const {
+    addPawnMoves(moves);
+    addRookMoves(moves);
+}
+
+/**
+ * @brief Checks a single move without generating the move list.
+ * @param move Any move, including ones built from untrusted raw values
+ * @return True if the side to move may play it. False otherwise.
+ */
+bool Board::isLegal(const Move &move) const {
+    const BoardTables::Tables &tables = BoardTables::TABLES;
+    const int from = move.from();
+    const int to = move.to();
+    const Bitboard target = bit(to);
+    const Bitboard own = by_side_[side_to_move_];
+
+    // Raw values with bits above the flag set never come out of generateMoves()
+    if ((move.raw() >> 14) != 0 || !(own & bit(from))) {
+        return false;
+    }
+
+    if (kind_[from] == static_cast<int>(PieceKind::PAWN)) {
+        // The same targets addPawnMoves() builds, for this one pawn
+        const int up = (moving_up_ & bit(from)) != 0;
+        const Bitboard empty = ~occupied();
+        const Bitboard single = tables.pawnPush[up][from] & empty;
+        const Bitboard twice = (single && (double_jump_ & bit(from))) ? tables.pawnDoublePush[up][from] & empty : 0;
+        const Bitboard captures = tables.pawnCapture[up][from] & by_side_[side_to_move_ ^ 1];
+        if (!((single | twice | captures) & target)) {
+            return false;
+        }
+        const Bitboard lastRow = up ? LAST_ROW : FIRST_ROW;
+        const Move::Flag expected = (target & lastRow) ? Move::PROMOTION
+                                    : (target & twice) ? Move::DOUBLE_PUSH : Move::QUIET;
+        return move.flag() == expected;
+    }
+
+    if (kind_[from] == static_cast<int>(PieceKind::ROOK)) {
+        if (move.flag() == Move::CASTLE) {
+            return castle_moves_[from] > 0 && (tables.adjacent[from] & own & target);
+        }
+        return move.flag() == Move::QUIET && (tables.rook[from] & target) && !(own & target)
+               && !(tables.between[from][to] & occupied());
+    }
+    return false;
+}
+
+void Board::addPawnMoves(MoveList &moves) const {
+    const Bitboard pawns = by_kind_[side_to_move_][static_cast<int>(PieceKind::PAWN)];
+    const Bitboard empty = ~occupied();
+    const Bitboard enemies = by_side_[side_to_move_ ^ 1];
+
+    // Pawns moving up advance by +N, pawns moving down by -N; both sets are shifted at once
+    Bitboard up = pawns & moving_up_;
+    Bitboard single = (up << N) & empty;
+    addPawnTargets(moves, single, N, LAST_ROW, Move::QUIET);
+    addPawnTargets(moves, ((single & ((up & double_jump_) << N)) << N) & empty, 2 * N, LAST_ROW, Move::DOUBLE_PUSH);
+    addPawnTargets(moves, ((up & ~FIRST_COLUMN) << (N - 1)) & enemies, N - 1, LAST_ROW, Move::QUIET);
+    addPawnTargets(moves, ((up & ~LAST_COLUMN) << (N + 1)) & enemies, N + 1, LAST_ROW, Move::QUIET);
+
+    Bitboard down = pawns & ~moving_up_;
+    single = (down >> N) & empty;
+    addPawnTargets(moves, single, -N, FIRST_ROW, Move::QUIET);
+    addPawnTargets(moves, ((single & ((down & double_jump_) >> N)) >> N) & empty, -2 * N, FIRST_ROW, Move::DOUBLE_PUSH);
+    addPawnTargets(moves, ((down & ~LAST_COLUMN) >> (N - 1)) & enemies, -(N - 1), FIRST_ROW, Move::QUIET);
+    addPawnTargets(moves, ((down & ~FIRST_COLUMN) >> (N + 1)) & enemies, -(N + 1), FIRST_ROW, Move::QUIET);
+}
+
+void Board::addRookMoves(MoveList &moves) const {
+    const Bitboard own = by_side_[side_to_move_];
+    const Bitboard all = occupied();
+
+    Bitboard rooks = by_kind_[side_to_move_][static_cast<int>(PieceKind::ROOK)];
+    while (rooks) {
+        int from = BitUtil::popLsb(rooks);
+        Bitboard targets = BoardTables::rookAttacks(from, all) & ~own;
+        while (targets) {
+            moves.add(Move(from, BitUtil::popLsb(targets)));
+        }
+
+        // Castling follows Rook::canCastle: any laterally adjacent piece of the same color
+        if (castle_moves_[from] > 0) {
+            Bitboard partners = BoardTables::TABLES.adjacent[from] & own;
+            while (partners) {
+                moves.add(Move(from, BitUtil::popLsb(partners), Move::CASTLE));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Plays a move generated by generateMoves().
+ * @param move The move to play
+ * @return The information unmakeMove() needs to take the move back
+ */
+Board::Undo Board::makeMove(const Move &move) {
+    const int from = move.from();
+    const int to = move.to();
+    const int us = side_to_move_;
+    const PieceKind kind = static_cast<PieceKind>(kind_[from]);
+    const bool up = (moving_up_ & bit(from)) != 0;
+    const std::int32_t castleMoves = castle_moves_[from];
+
+    Undo undo;
+    undo.captured = NO_PIECE;
+    undo.capturedUp = false;
+    undo.capturedDoubleJump = false;
+    undo.capturedCastleMoves = 0;
+    undo.movedDoubleJump = (double_jump_ & bit(from)) != 0;
+    undo.pliesSinceProgress = plies_since_progress_;
+
+    if (move.flag() == Move::CASTLE) {
+        // The rook and its partner trade squares and the rook spends one castle move
+        const PieceKind partner = static_cast<PieceKind>(kind_[to]);
+        const bool partnerUp = (moving_up_ & bit(to)) != 0;
+        const bool partnerDoubleJump = (double_jump_ & bit(to)) != 0;
+        const std::int32_t partnerCastleMoves = castle_moves_[to];
+        remove(from);
+        remove(to);
+        put(to, us, kind, up, false, castleMoves - 1);
+        put(from, us, partner, partnerUp, partnerDoubleJump, partnerCastleMoves);
+        plies_since_progress_ = 0;
+    } else {
+        bool progress = kind == PieceKind::PAWN;
+        if (kind_[to] != NO_PIECE) {
+            undo.captured = kind_[to];
+            undo.capturedUp = (moving_up_ & bit(to)) != 0;
+            undo.capturedDoubleJump = (double_jump_ & bit(to)) != 0;
+            undo.capturedCastleMoves = castle_moves_[to];
+            remove(to);
+            progress = true;
+        }
+        remove(from);
+        if (move.flag() == Move::PROMOTION) {
+            put(to, us, PieceKind::ROOK, up, false, 0);
+        } else {
+            // A pawn that has moved can no longer double jump
+            put(to, us, kind, up, false, castleMoves);
+        }
+        plies_since_progress_ = progress ? 0 : plies_since_progress_ + 1;
+    }
+
+    side_to_move_ ^= 1;
+    key_ ^= zobrist().blackToMove;
+    return undo;
+}
+
+/**
+ * @brief Computes the key the position would have after a move, without playing it.
+ * @param move A move generated by generateMoves()
+ * @return The same value key() returns after makeMove(move)
+ */
+std::uint64_t Board::keyAfter(const Move &move) const {
+    const int from = move.from();
+    const int to = move.to();
+    const int us = side_to_move_;
+    const PieceKind kind = static_cast<PieceKind>(kind_[from]);
+    const bool up = (moving_up_ & bit(from)) != 0;
+
+    // Whatever stands on the two squares leaves them, then the same puts as makeMove() follow
+    std::uint64_t key = key_ ^ zobrist().blackToMove ^ squareKey(from);
+    if (kind_[to] != NO_PIECE) {
+        key ^= squareKey(to);
+    }
+    if (move.flag() == Move::CASTLE) {
+        key ^= pieceKey(to, us, kind, up, false, castle_moves_[from] - 1);
+        key ^= pieceKey(from, us, static_cast<PieceKind>(kind_[to]), (moving_up_ & bit(to)) != 0,
+                        (double_jump_ & bit(to)) != 0, castle_moves_[to]);
+    } else if (move.flag() == Move::PROMOTION) {
+        key ^= pieceKey(to, us, PieceKind::ROOK, up, false, 0);
+    } else {
+        key ^= pieceKey(to, us, kind, up, false, castle_moves_[from]);
+    }
+    return key;
+}
+
+/**
+ * @brief Takes back the last move played.
+ * @param move The move that was played
+ * @param undo The value makeMove() returned for it
+ */
+void Board::unmakeMove(const Move &move, const Undo &undo) {
+    const int from = move.from();
+    const int to = move.to();
+    side_to_move_ ^= 1;
+    key_ ^= zobrist().blackToMove;
+    const int us = side_to_move_;
+    const PieceKind kind = static_cast<PieceKind>(kind_[to]);
+    const bool up = (moving_up_ & bit(to)) != 0;
+    const std::int32_t castleMoves = castle_moves_[to];
+
+    if (move.flag() == Move::CASTLE) {
+        const PieceKind partner = static_cast<PieceKind>(kind_[from]);
+        const bool partnerUp = (moving_up_ & bit(from)) != 0;
+        const bool partnerDoubleJump = (double_jump_ & bit(from)) != 0;
+        const std::int32_t partnerCastleMoves = castle_moves_[from];
+        remove(from);
+        remove(to);
+        put(from, us, kind, up, false, castleMoves + 1);
+        put(to, us, partner, partnerUp, partnerDoubleJump, partnerCastleMoves);
+    } else {
+        remove(to);
+        if (move.flag() == Move::PROMOTION) {
+            put(from, us, PieceKind::PAWN, up, undo.movedDoubleJump, 0);
+        } else {
+            put(from, us, kind, up, undo.movedDoubleJump, castleMoves);
+        }
+        if (undo.captured != NO_PIECE) {
+            put(to, us ^ 1, static_cast<PieceKind>(undo.captured), undo.capturedUp,
+                undo.capturedDoubleJump, undo.capturedCastleMoves);
+        }
+    }
+    plies_since_progress_ = undo.pliesSinceProgress;
+}
+
+/**
+ * @brief Scores the position for the side to move.
+ * @param moves The legal moves of the side to move, as produced by generateMoves()
+ * @return ONGOING, SIDE_TO_MOVE_LOST if it has no pieces left, or DRAW if it has no
+ *         legal move or DRAW_PLIES plies passed without progress
+ */
+Board::Result Board::result(const MoveList &moves) const {
+    if (by_side_[side_to_move_] == 0) {
+        return SIDE_TO_MOVE_LOST;
+    }
+    if (moves.size() == 0 || plies_since_progress_ >= DRAW_PLIES) {
+        return DRAW;
+    }
+    return ONGOING;
+}
+
+void Board::put(int square, int side, PieceKind kind, bool movingUp, bool doubleJump, std::int32_t castleMoves) {
+    const Bitboard mask = bit(square);
+    by_kind_[side][static_cast<int>(kind)] |= mask;
+    by_side_[side] |= mask;
+    if (movingUp) {
+        moving_up_ |= mask;
+    }
+    if (doubleJump) {
+        double_jump_ |= mask;
+    }
+    kind_[square] = static_cast<std::int8_t>(kind);
+    castle_moves_[square] = castleMoves;
+    key_ ^= squareKey(square);
+}
+
+void Board::remove(int square) {
+    if (kind_[square] == NO_PIECE) {
+        return;
+    }
+    key_ ^= squareKey(square);
+    const Bitboard mask = ~bit(square);
+    for (int side = 0; side < 2; ++side) {
+        by_side_[side] &= mask;
+        for (int kind = 0; kind < 3; ++kind) {
+            by_kind_[side][kind] &= mask;
+        }
+    }
+    moving_up_ &= mask;
+    double_jump_ &= mask;
+    kind_[square] = NO_PIECE;
+    castle_moves_[square] = 0;
+}
+
+std::uint64_t Board::squareKey(int square) const {
+    const Bitboard mask = bit(square);
+    return pieceKey(square, sideAt(square), static_cast<PieceKind>(kind_[square]), (moving_up_ & mask) != 0,
+                    (double_jump_ & mask) != 0, castle_moves_[square]);
+}
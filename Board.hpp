@@ -0,0 +1,274 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Board.hpp
+ * @brief This file defines the Board class, a bitboard representation of a pawn-and-rook position,
+ *        along with the Move and MoveList types used to play on it.
+ *
+ * The Board is built from Pawn, Rook and generic ChessPiece objects of the two colors WHITE and
+ * BLACK, and plays the game those classes describe:
+ *   - Pawns push one square in their direction (isMovingUp), two squares if canDoubleJump, and
+ *     capture one square diagonally forward. A pawn reaching the row where canPromote holds
+ *     becomes a Rook with no castle moves, keeping its color, square and direction.
+ *   - Rooks slide along rows and columns and may castle with a laterally adjacent piece of their
+ *     own color while they have castle moves left (see Rook::castle).
+ *   - Generic pieces do not move but can be captured.
+ * A side with no pieces left has lost; a side with no legal move, or a position with 100 plies
+ * since the last pawn move, capture or castle, is a draw.
+ *
+ * Squares are numbered row * BOARD_LENGTH + column, so bit 0 is (0,0) and bit 63 is (7,7).
+ */
+
+#ifndef CHESS_BOARD_HPP
+#define CHESS_BOARD_HPP
+
+
+#include <cstdint>
+#include <vector>
+#include "ChessPiece.hpp"
+#include "Pawn.hpp"
+#include "Rook.hpp"
+#include "PieceRecord.hpp"
+
+static_assert(ChessPiece::BOARD_LENGTH == 8, "The bitboards hold one bit per square in a 64 bit word");
+
+typedef std::uint64_t Bitboard;
+
+class Move {
+public:
+    enum Flag {
+        QUIET = 0,          // A plain move or capture
+        DOUBLE_PUSH = 1,    // A pawn moving two squares
+        PROMOTION = 2,      // A pawn moving onto its last row, becoming a rook
+        CASTLE = 3          // A rook trading squares with an adjacent piece of its color
+    };
+
+private:
+    std::uint16_t data_;
+
+public:
+    /**
+     * @brief Default Constructor. Creates the null move (a1 to a1), which is never legal.
+     */
+    Move();
+
+    /**
+     * @brief Parameterized constructor.
+     * @param from The square the moving piece starts on
+     * @param to The square it ends on (for a castle, the square of the partner piece)
+     * @param flag The kind of move, one of Move::Flag
+     */
+    Move(int from, int to, Flag flag = QUIET);
+
+    int from() const;
+    int to() const;
+    Flag flag() const;
+
+    /**
+     * @return The 16 bit encoding of the move: from | to << 6 | flag << 12
+     */
+    std::uint16_t raw() const;
+
+    /**
+     * @brief Rebuilds a move from its 16 bit encoding.
+     * @param raw A value returned by raw()
+     * @return The encoded move
+     */
+    static Move fromRaw(std::uint16_t raw);
+
+    bool operator==(const Move &other) const;
+    bool operator!=(const Move &other) const;
+};
+
+class MoveList {
+public:
+    // Each piece has at most 14 rook moves and 2 castles, so 64 pieces never exceed this
+    static const int CAPACITY = 1024;
+
+private:
+    // Raw encodings, so an empty list costs nothing to construct
+    std::uint16_t moves_[CAPACITY];
+    int size_;
+
+public:
+    MoveList();
+
+    void add(const Move &move);
+    int size() const;
+    Move operator[](int index) const;
+};
+
+class Board {
+public:
+    static const int SQUARES = ChessPiece::BOARD_LENGTH * ChessPiece::BOARD_LENGTH;
+    static const int WHITE = PieceRecord::WHITE;
+    static const int BLACK = PieceRecord::BLACK;
+    static const int NO_PIECE = -1;
+    static const int DRAW_PLIES = 100;
+
+    enum Result {
+        ONGOING,
+        SIDE_TO_MOVE_LOST,
+        DRAW
+    };
+
+    /**
+     * @brief Everything makeMove() changes that unmakeMove() cannot recompute.
+     */
+    struct Undo {
+        std::int8_t captured;           // PieceKind of the captured piece, or NO_PIECE
+        bool capturedUp;
+        bool capturedDoubleJump;
+        bool movedDoubleJump;
+        std::int32_t capturedCastleMoves;
+        int pliesSinceProgress;
+    };
+
+private:
+    Bitboard by_kind_[2][3];        // [side][PieceKind]
+    Bitboard by_side_[2];
+    Bitboard moving_up_;
+    Bitboard double_jump_;
+    std::int8_t kind_[SQUARES];     // PieceKind on each square, or NO_PIECE
+    std::int32_t castle_moves_[SQUARES];
+    int side_to_move_;
+    int plies_since_progress_;
+    std::uint64_t key_;
+
+public:
+    /**
+     * @brief Default Constructor. Creates an empty board with WHITE to move.
+     */
+    Board();
+
+    /**
+     * @brief Places a piece on the board.
+     * @param piece The piece to place. Overloads keep the pawn and rook specific state.
+     * @return True if the piece was placed. False if its kind is unknown, its color is neither
+     *         WHITE nor BLACK, its row or column is not in [0, BOARD_LENGTH), it is a rook with
+     *         negative castle moves, or its square is already taken (nothing is placed then).
+     */
+    bool place(const ChessPiece &piece);
+    bool place(const Pawn &pawn);
+    bool place(const Rook &rook);
+    bool place(const PieceRecord &record);
+
+    /**
+     * @brief Removes every piece and resets the side to move and ply counter.
+     */
+    void clear();
+
+    /**
+     * @return The pieces on the board, in square order
+     */
+    std::vector<PieceRecord> pieces() const;
+
+    int sideToMove() const;
+    void setSideToMove(int side);
+    int pliesSinceProgress() const;
+
+    /**
+     * @brief Gets the Zobrist key of the position. It covers every piece with its side, kind,
+     *        direction, double jump flag and castle moves, plus the side to move, and is kept
+     *        up to date incrementally by every change to the board.
+     * @return The 64 bit key
+     */
+    std::uint64_t key() const;
+
+    /**
+     * @return The squares holding pieces of the given side and kind
+     */
+    Bitboard pieces(int side, PieceKind kind) const;
+
+    /**
+     * @return The squares holding pieces of the given side
+     */
+    Bitboard occupied(int side) const;
+
+    /**
+     * @return The squares holding any piece
+     */
+    Bitboard occupied() const;
+
+    /**
+     * @return The squares holding pieces that are moving up
+     */
+    Bitboard movingUp() const;
+
+    /**
+     * @return The squares holding pawns that can still double jump
+     */
+    Bitboard doubleJumpers() const;
+
+    /**
+     * @param square A square in [0, SQUARES)
+     * @return The PieceKind on the square, or NO_PIECE
+     */
+    int kindAt(int square) const;
+
+    /**
+     * @param square A square in [0, SQUARES)
+     * @return The side owning the piece on the square, or NO_PIECE if it is empty
+     */
+    int sideAt(int square) const;
+
+    /**
+     * @param square A square holding a rook
+     * @return The castle moves that rook has left
+     */
+    int castleMovesAt(int square) const;
+
+    /**
+     * @brief Generates every legal move for the side to move.
+     * @param moves A reference to the list that receives the moves (it is not cleared first)
+     */
+    void generateMoves(MoveList &moves) const;
+
+    /**
+     * @brief Checks a single move, eg. one received from a client, without generating the move list.
+     *        The answer is the same as searching the list generateMoves() would produce.
+     * @param move Any move, including ones built from untrusted raw values
+     * @return True if the side to move may play it. False otherwise.
+     */
+    bool isLegal(const Move &move) const;
+
+    /**
+     * @brief Plays a move generated by generateMoves().
+     * @param move The move to play
+     * @return The information unmakeMove() needs to take the move back
+     */
+    Undo makeMove(const Move &move);
+
+    /**
+     * @brief Takes back the last move played.
+     * @param move The move that was played
+     * @param undo The value makeMove() returned for it
+     */
+    void unmakeMove(const Move &move, const Undo &undo);
+
+    /**
+     * @brief Computes the key the position would have after a move, without playing it.
+     *        Lets callers start loading hash table entries before the move is made.
+     * @param move A move generated by generateMoves()
+     * @return The same value key() returns after makeMove(move)
+     */
+    std::uint64_t keyAfter(const Move &move) const;
+
+    /**
+     * @brief Scores the position for the side to move.
+     * @param moves The legal moves of the side to move, as produced by generateMoves()
+     * @return ONGOING, SIDE_TO_MOVE_LOST if it has no pieces left, or DRAW if it has no
+     *         legal move or DRAW_PLIES plies passed without progress
+     */
+    Result result(const MoveList &moves) const;
+
+private:
+    void put(int square, int side, PieceKind kind, bool movingUp, bool doubleJump, std::int32_t castleMoves);
+    void remove(int square);
+    std::uint64_t squareKey(int square) const;
+    void addPawnMoves(MoveList &moves) const;
+    void addRookMoves(MoveList &moves) const;
+};
+
+
+#endif //CHESS_BOARD_HPP
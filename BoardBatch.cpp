@@ -0,0 +1,311 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file BoardBatch.cpp
+ * @brief This file contains the implementation of the BoardBatch class.
+ *
+ * step() is written without data-dependent branches or memory accesses outside its block: every
+ * condition becomes an all-ones or all-zeros mask and every update is a masked select, so the
+ * lanes never diverge and the loop vectorizes. Pawn and rook targets are computed with constant
+ * shifts rather than BoardTables lookups, which would turn into gathers when each lane plays a
+ * different move; the only variable shifts, from squares to bits, are done in a short scalar
+ * prologue since 64-bit shifts by a per-lane count do not vectorize everywhere.
+ */
+
+#include <algorithm>
+#include "BitUtil.hpp"
+#include "BoardBatch.hpp"
+
+namespace {
+    const int N = ChessPiece::BOARD_LENGTH;
+    const int W = BoardBatch::WIDTH;
+    const Bitboard FIRST_COLUMN = 0x0101010101010101ULL;
+    const Bitboard LAST_COLUMN = FIRST_COLUMN << (N - 1);
+    const Bitboard FIRST_ROW = 0xFFULL;
+    const Bitboard LAST_ROW = FIRST_ROW << (N * (N - 1));
+    const Bitboard ALL = ~Bitboard(0);
+
+    // All ones if the value is non-zero, else all zeros
+    inline Bitboard maskOf(Bitboard value) {
+        return Bitboard(0) - static_cast<Bitboard>(value != 0);
+    }
+
+    inline Bitboard select(Bitboard mask, Bitboard ifSet, Bitboard ifClear) {
+        return (ifSet & mask) | (ifClear & ~mask);
+    }
+
+    // Moves the bits at the two (single bit) squares into each other's place
+    inline Bitboard swapBits(Bitboard value, Bitboard f, Bitboard t) {
+        return value ^ ((maskOf(value & f) ^ maskOf(value & t)) & (f | t));
+    }
+
+    // The column through a single bit square, found by folding the rows onto the first one
+    inline Bitboard columnOf(Bitboard f) {
+        f |= f >> 32;
+        f |= f >> 16;
+        f |= f >> 8;
+        return (f & FIRST_ROW) * FIRST_COLUMN;
+    }
+
+    // The row through a single bit square, found by sliding it to the first column of its row
+    inline Bitboard rowOf(Bitboard f) {
+        f |= (f >> 1) & 0x7F7F7F7F7F7F7F7FULL;
+        f |= (f >> 2) & 0x3F3F3F3F3F3F3F3FULL;
+        f |= (f >> 4) & 0x0F0F0F0F0F0F0F0FULL;
+        return (f & FIRST_COLUMN) * FIRST_ROW;
+    }
+}
+
+/**
+ * @brief Parameterized constructor. Every lane starts as an empty board with WHITE to move.
+ * @param lanes The number of games in the batch
+ */
+BoardBatch::BoardBatch(std::size_t lanes)
+        : lanes_(lanes), blocks_((lanes + W - 1) / W, Block()), castles_(lanes * Board::SQUARES, 0) {
+}
+
+/**
+ * @return The number of games in the batch
+ */
+std::size_t BoardBatch::lanes() const {
+    return lanes_;
+}
+
+/**
+ * @brief Copies a position into a lane.
+ * @param lane The lane to overwrite
+ * @param board A const reference to the position
+ */
+void BoardBatch::load(std::size_t lane, const Board &board) {
+    Block &block = blocks_[lane / W];
+    const std::size_t i = lane % W;
+    for (int side = 0; side < 2; ++side) {
+        for (int kind = 0; kind < 3; ++kind) {
+            block.pieces[side][kind][i] = board.pieces(side, static_cast<PieceKind>(kind));
+        }
+    }
+    block.movingUp[i] = board.movingUp();
+    block.doubleJump[i] = board.doubleJumpers();
+    block.castlers[i] = 0;
+    block.side[i] = static_cast<Bitboard>(board.sideToMove());
+    for (int square = 0; square < Board::SQUARES; ++square) {
+        const int castles = board.kindAt(square) == Board::NO_PIECE ? 0 : board.castleMovesAt(square);
+        castles_[lane * Board::SQUARES + square] = castles;
+        if (board.kindAt(square) == static_cast<int>(PieceKind::ROOK) && castles > 0) {
+            block.castlers[i] |= Bitboard(1) << square;
+        }
+    }
+}
+
+/**
+ * @brief Copies a lane out into a Board (with a freshly computed key and no ply history).
+ * @param lane The lane to read
+ * @param board A reference to the board to overwrite
+ */
+void BoardBatch::store(std::size_t lane, Board &board) const {
+    const Block &block = blocks_[lane / W];
+    const std::size_t i = lane % W;
+    board.clear();
+    for (int side = 0; side < 2; ++side) {
+        for (int kind = 0; kind < 3; ++kind) {
+            Bitboard squares = block.pieces[side][kind][i];
+            while (squares) {
+                const int square = BitUtil::popLsb(squares);
+                PieceRecord record;
+                record.kind = static_cast<PieceKind>(kind);
+                record.row = static_cast<std::int8_t>(square / N);
+                record.column = static_cast<std::int8_t>(square % N);
+                record.movingUp = (block.movingUp[i] >> square) & 1;
+                record.doubleJumpable = (block.doubleJump[i] >> square) & 1;
+                record.color = static_cast<std::uint16_t>(side);
+                record.castleMovesLeft = castles_[lane * Board::SQUARES + square];
+                board.place(record);
+            }
+        }
+    }
+    board.setSideToMove(static_cast<int>(block.side[i]));
+}
+
+/**
+ * @brief Plays the same move in every lane where it is legal.
+ * @param move The move to play
+ * @param applied A pointer to lanes() flags that receive 1 where the move was played, 0 elsewhere
+ * @return The number of lanes the move was played in
+ */
+std::size_t BoardBatch::apply(const Move &move, std::uint8_t *applied) {
+    Bitboard moves[W];
+    Bitboard actions[W];
+    for (int i = 0; i < W; ++i) {
+        moves[i] = move.raw();
+    }
+    std::size_t count = 0;
+    for (std::size_t b = 0; b < blocks_.size(); ++b) {
+        step(blocks_[b], moves, actions);
+        count += finish(b * W, moves, actions, applied);
+    }
+    return count;
+}
+
+/**
+ * @brief Plays one move per lane, in every lane where that lane's move is legal.
+ * @param moves A pointer to lanes() moves
+ * @param applied A pointer to lanes() flags that receive 1 where the move was played, 0 elsewhere
+ * @return The number of lanes a move was played in
+ */
+std::size_t BoardBatch::apply(const Move *moves, std::uint8_t *applied) {
+    Bitboard raw[W];
+    Bitboard actions[W];
+    std::size_t count = 0;
+    for (std::size_t b = 0; b < blocks_.size(); ++b) {
+        const std::size_t first = b * W;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(W); ++i) {
+            raw[i] = first + i < lanes_ ? moves[first + i].raw() : 0;  // From a square to itself: never legal
+        }
+        step(blocks_[b], raw, actions);
+        count += finish(first, raw, actions, applied);
+    }
+    return count;
+}
+
+/**
+ * @brief Finds, in every lane, the pawns that can promote (Pawn::canPromote: on their last row).
+ * @param out A pointer to lanes() bitboards that receive the promotable pawns of both sides
+ * @return The number of lanes with at least one promotable pawn
+ */
+std::size_t BoardBatch::promotable(Bitboard *out) const {
+    const int PAWN = static_cast<int>(PieceKind::PAWN);
+    std::size_t found = 0;
+    for (std::size_t b = 0; b < blocks_.size(); ++b) {
+        const Block &block = blocks_[b];
+        Bitboard promoting[W];
+        for (int i = 0; i < W; ++i) {
+            const Bitboard pawns = block.pieces[Board::WHITE][PAWN][i] | block.pieces[Board::BLACK][PAWN][i];
+            promoting[i] = (pawns & block.movingUp[i] & LAST_ROW) | (pawns & ~block.movingUp[i] & FIRST_ROW);
+        }
+        for (std::size_t i = 0; i < static_cast<std::size_t>(W) && b * W + i < lanes_; ++i) {
+            out[b * W + i] = promoting[i];
+            found += promoting[i] != 0;
+        }
+    }
+    return found;
+}
+
+// The rules of Board::isLegal and Board::makeMove, evaluated as masks in every lane of a block
+void BoardBatch::step(Block &block, const Bitboard *moves, Bitboard *actions) {
+    const int PIECE = static_cast<int>(PieceKind::PIECE);
+    const int PAWN = static_cast<int>(PieceKind::PAWN);
+    const int ROOK = static_cast<int>(PieceKind::ROOK);
+
+    // Local copies, which the compiler knows cannot alias the block
+    Bitboard fromBit[W];
+    Bitboard toBit[W];
+    Bitboard flags[W];
+    Bitboard done[W];
+    for (int i = 0; i < W; ++i) {
+        fromBit[i] = Bitboard(1) << (moves[i] & (Board::SQUARES - 1));
+        toBit[i] = Bitboard(1) << ((moves[i] >> 6) & (Board::SQUARES - 1));
+        flags[i] = moves[i] >> 12;
+    }
+
+    for (int i = 0; i < W; ++i) {
+        const Bitboard f = fromBit[i];
+        const Bitboard t = toBit[i];
+        const Bitboard flag = flags[i];
+
+        // Everything seen from the side to move of this lane
+        const Bitboard black = Bitboard(0) - block.side[i];
+        Bitboard ownKind[3];
+        Bitboard own = 0;
+        Bitboard occupied = 0;
+        for (int kind = 0; kind < 3; ++kind) {
+            ownKind[kind] = select(black, block.pieces[Board::BLACK][kind][i], block.pieces[Board::WHITE][kind][i]);
+            own |= ownKind[kind];
+            occupied |= block.pieces[Board::WHITE][kind][i] | block.pieces[Board::BLACK][kind][i];
+        }
+        const Bitboard enemy = occupied & ~own;
+        const Bitboard empty = ~occupied;
+        const Bitboard up = maskOf(block.movingUp[i] & f);
+        const Bitboard isPawn = maskOf(ownKind[PAWN] & f);
+        const Bitboard isRook = maskOf(ownKind[ROOK] & f);
+
+        // Pawn targets, as in Board::addPawnMoves
+        const Bitboard push = select(up, f << N, f >> N) & empty;
+        const Bitboard twice = select(up, push << N, push >> N) & empty & maskOf(block.doubleJump[i] & f);
+        const Bitboard captures = select(up, ((f & ~FIRST_COLUMN) << (N - 1)) | ((f & ~LAST_COLUMN) << (N + 1)),
+                                         ((f & ~LAST_COLUMN) >> (N - 1)) | ((f & ~FIRST_COLUMN) >> (N + 1))) & enemy;
+        const Bitboard promotes = maskOf(t & select(up, LAST_ROW, FIRST_ROW));
+        const Bitboard pawnFlag = select(promotes, Move::PROMOTION, select(maskOf(t & twice), Move::DOUBLE_PUSH, Move::QUIET));
+        const Bitboard pawnMove = isPawn & maskOf((push | twice | captures) & t) & ~maskOf(flag ^ pawnFlag);
+
+        // Rook slides: aligned, nothing in between, not onto an own piece
+        const Bitboard column = columnOf(f);
+        const Bitboard sameRow = maskOf(rowOf(f) & t);
+        const Bitboard sameColumn = maskOf(column & t);
+        const Bitboard low = select(maskOf(f > t), t, f);
+        const Bitboard high = select(maskOf(f > t), f, t);
+        const Bitboard between = (high - (low << 1)) & select(sameRow, ALL, column);
+        const Bitboard slide = isRook & ~maskOf(flag ^ Move::QUIET) & maskOf(f ^ t) & (sameRow | sameColumn)
+                               & ~maskOf(between & occupied) & ~maskOf(own & t);
+
+        // Castles: an adjacent own piece while castle moves remain
+        const Bitboard castle = isRook & ~maskOf(flag ^ Move::CASTLE) & sameRow & maskOf(((f << 1) | (f >> 1)) & t)
+                                & maskOf(own & t) & maskOf(block.castlers[i] & f);
+
+        const Bitboard take = pawnMove | slide;
+        const Bitboard promoted = pawnMove & promotes;
+        const Bitboard arrives[3] = {0, t & isPawn & ~promoted, t & (slide | promoted)};
+
+        // Plain moves and captures clear both squares everywhere, then drop the piece on the target
+        for (int side = 0; side < 2; ++side) {
+            const Bitboard mine = side == Board::BLACK ? black : ~black;
+            for (int kind = PIECE; kind <= ROOK; ++kind) {
+                Bitboard &bits = block.pieces[side][kind][i];
+                bits = select(take, (bits & ~(f | t)) | (arrives[kind] & mine),
+                              select(castle, swapBits(bits, f, t), bits));
+            }
+        }
+        Bitboard &movingUp = block.movingUp[i];
+        movingUp = select(take, (movingUp & ~(f | t)) | (up & t), select(castle, swapBits(movingUp, f, t), movingUp));
+        Bitboard &doubleJump = block.doubleJump[i];
+        doubleJump = select(take, doubleJump & ~(f | t), select(castle, swapBits(doubleJump, f, t), doubleJump));
+        Bitboard &castlers = block.castlers[i];
+        castlers = select(take, (castlers & ~(f | t)) | (maskOf(castlers & f) & slide & t),
+                          select(castle, swapBits(castlers, f, t), castlers));
+
+        block.side[i] ^= (take | castle) & 1;
+        done[i] = (pawnMove & select(promoted, PROMOTED, PAWN_MOVED)) | (slide & ROOK_MOVED) | (castle & CASTLED);
+    }
+
+    for (int i = 0; i < W; ++i) {
+        actions[i] = done[i];
+    }
+}
+
+// Moves the castle counts of the lanes where a rook moved or appeared, and retires rooks out of castles
+std::size_t BoardBatch::finish(std::size_t first, const Bitboard *moves, const Bitboard *actions, std::uint8_t *applied) {
+    const std::size_t width = std::min(static_cast<std::size_t>(W), lanes_ - first);
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < width; ++i) {
+        applied[first + i] = actions[i] != NONE;
+        count += actions[i] != NONE;
+    }
+    for (std::size_t i = 0; i < width; ++i) {
+        if (actions[i] <= PAWN_MOVED) {
+            continue;
+        }
+        const int from = static_cast<int>(moves[i] & (Board::SQUARES - 1));
+        const int to = static_cast<int>((moves[i] >> 6) & (Board::SQUARES - 1));
+        std::int32_t *castles = &castles_[(first + i) * Board::SQUARES];
+        if (actions[i] == CASTLED) {
+            const std::int32_t left = castles[from] - 1;
+            castles[from] = castles[to];
+            castles[to] = left;
+            if (left == 0) {
+                blocks_[first / W].castlers[i] &= ~(Bitboard(1) << to);
+            }
+        } else {
+            castles[to] = actions[i] == PROMOTED ? 0 : castles[from];
+        }
+    }
+    return count;
+}
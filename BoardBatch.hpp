@@ -0,0 +1,110 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file BoardBatch.hpp
+ * @brief This file declares the BoardBatch class, many independent games advanced in lockstep.
+ *
+ * Lane i of the batch is one game. The boards are stored lane-major in blocks of WIDTH lanes: each
+ * bitboard of the Board representation (pieces per side and kind, directions, double jump flags,
+ * rooks that may still castle, side to move) is a WIDTH-long array inside the block, so one step
+ * of every game in a block is a fixed-length loop over adjacent words that the compiler turns into
+ * SIMD code. A move is checked and played in all lanes at once with masks instead of branches;
+ * lanes where the move is not legal are left untouched. Only the castle counts are kept per lane
+ * (64 counters each) and updated afterwards, and only when a rook moved or appeared, since just the
+ * two squares of such a move are ever read. Counts left on squares without a rook are stale.
+ *
+ * The batch tracks the pieces and the side to move; Zobrist keys and ply counters stay with
+ * Board, which a lane can be converted back to at any time.
+ */
+
+#ifndef CHESS_BOARD_BATCH_HPP
+#define CHESS_BOARD_BATCH_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Board.hpp"
+
+class BoardBatch {
+public:
+    static const int WIDTH = 8;         // Lanes per block: one 512-bit register of bitboards
+
+private:
+    struct alignas(64) Block {
+        Bitboard pieces[2][3][WIDTH];   // [side][PieceKind][lane]
+        Bitboard movingUp[WIDTH];
+        Bitboard doubleJump[WIDTH];
+        Bitboard castlers[WIDTH];       // Rooks with castle moves left
+        Bitboard side[WIDTH];           // 0 for WHITE and 1 for BLACK
+    };
+
+    // What a step did in one lane; only the last three change castle counts
+    enum Action : std::uint8_t {
+        NONE = 0,
+        PAWN_MOVED = 1,
+        ROOK_MOVED = 2,
+        PROMOTED = 3,
+        CASTLED = 4
+    };
+
+    std::size_t lanes_;
+    std::vector<Block> blocks_;
+    std::vector<std::int32_t> castles_; // [lane * SQUARES + square]
+
+public:
+    /**
+     * @brief Parameterized constructor. Every lane starts as an empty board with WHITE to move.
+     * @param lanes The number of games in the batch
+     */
+    explicit BoardBatch(std::size_t lanes);
+
+    /**
+     * @return The number of games in the batch
+     */
+    std::size_t lanes() const;
+
+    /**
+     * @brief Copies a position into a lane.
+     * @param lane The lane to overwrite
+     * @param board A const reference to the position
+     */
+    void load(std::size_t lane, const Board &board);
+
+    /**
+     * @brief Copies a lane out into a Board (with a freshly computed key and no ply history).
+     * @param lane The lane to read
+     * @param board A reference to the board to overwrite
+     */
+    void store(std::size_t lane, Board &board) const;
+
+    /**
+     * @brief Plays the same move in every lane where it is legal.
+     * @param move The move to play
+     * @param applied A pointer to lanes() flags that receive 1 where the move was played, 0 elsewhere
+     * @return The number of lanes the move was played in
+     */
+    std::size_t apply(const Move &move, std::uint8_t *applied);
+
+    /**
+     * @brief Plays one move per lane, in every lane where that lane's move is legal.
+     * @param moves A pointer to lanes() moves
+     * @param applied A pointer to lanes() flags that receive 1 where the move was played, 0 elsewhere
+     * @return The number of lanes a move was played in
+     */
+    std::size_t apply(const Move *moves, std::uint8_t *applied);
+
+    /**
+     * @brief Finds, in every lane, the pawns that can promote (Pawn::canPromote: on their last row).
+     * @param out A pointer to lanes() bitboards that receive the promotable pawns of both sides
+     * @return The number of lanes with at least one promotable pawn
+     */
+    std::size_t promotable(Bitboard *out) const;
+
+private:
+    static void step(Block &block, const Bitboard *moves, Bitboard *actions);
+    std::size_t finish(std::size_t first, const Bitboard *moves, const Bitboard *actions, std::uint8_t *applied);
+};
+
+
+#endif //CHESS_BOARD_BATCH_HPP
@@ -0,0 +1,123 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file BoardTables.hpp
+ * @brief This file defines the per-square lookup tables used by move generation: rook rays,
+ *        pawn push and capture masks, the lateral adjacency masks used for castling, and the
+ *        masks of the squares between two aligned squares.
+ *
+ * The tables are computed by constexpr functions from ChessPiece::BOARD_LENGTH, so the compiler
+ * evaluates them and they live in read-only data: nothing runs at startup, and no other static
+ * initializer can observe them half built.
+ */
+
+#ifndef CHESS_BOARD_TABLES_HPP
+#define CHESS_BOARD_TABLES_HPP
+
+
+#include "BitUtil.hpp"
+#include "Board.hpp"
+
+namespace BoardTables {
+
+    const int N = ChessPiece::BOARD_LENGTH;
+
+    // Rook directions. UP and RIGHT go towards higher squares, DOWN and LEFT towards lower ones.
+    enum Direction {
+        UP = 0,
+        DOWN = 1,
+        RIGHT = 2,
+        LEFT = 3
+    };
+
+    struct Tables {
+        Bitboard ray[4][Board::SQUARES];            // Squares beyond the square in a direction, up to the edge
+        Bitboard rook[Board::SQUARES];              // All four rays together (attacks on an empty board)
+        Bitboard adjacent[Board::SQUARES];          // The squares left and right of the square (castling partners)
+        Bitboard pawnPush[2][Board::SQUARES];       // [movingUp]: the square one row ahead
+        Bitboard pawnDoublePush[2][Board::SQUARES]; // [movingUp]: the square two rows ahead
+        Bitboard pawnCapture[2][Board::SQUARES];    // [movingUp]: the diagonal squares one row ahead
+        Bitboard between[Board::SQUARES][Board::SQUARES];   // Squares strictly between two squares on a row or column, else 0
+    };
+
+    constexpr bool onBoard(int row, int column) {
+        return row >= 0 && row < N && column >= 0 && column < N;
+    }
+
+    constexpr Bitboard squareBit(int row, int column) {
+        return onBoard(row, column) ? Bitboard(1) << (row * N + column) : 0;
+    }
+
+    constexpr Tables makeTables() {
+        const int rowStep[4] = {1, -1, 0, 0};
+        const int columnStep[4] = {0, 0, 1, -1};
+        Tables tables{};
+        for (int square = 0; square < Board::SQUARES; ++square) {
+            const int row = square / N;
+            const int column = square % N;
+            for (int direction = 0; direction < 4; ++direction) {
+                Bitboard ray = 0;
+                for (int r = row + rowStep[direction], c = column + columnStep[direction]; onBoard(r, c);
+                     r += rowStep[direction], c += columnStep[direction]) {
+                    ray |= squareBit(r, c);
+                }
+                tables.ray[direction][square] = ray;
+                tables.rook[square] |= ray;
+            }
+            tables.adjacent[square] = squareBit(row, column - 1) | squareBit(row, column + 1);
+            for (int up = 0; up < 2; ++up) {
+                const int forward = up ? 1 : -1;
+                tables.pawnPush[up][square] = squareBit(row + forward, column);
+                tables.pawnDoublePush[up][square] = squareBit(row + 2 * forward, column);
+                tables.pawnCapture[up][square] = squareBit(row + forward, column - 1) | squareBit(row + forward, column + 1);
+            }
+        }
+
+        // Walking each ray from a square meets every square aligned with it exactly once
+        for (int from = 0; from < Board::SQUARES; ++from) {
+            for (int direction = 0; direction < 4; ++direction) {
+                Bitboard passed = 0;
+                for (int r = from / N + rowStep[direction], c = from % N + columnStep[direction]; onBoard(r, c);
+                     r += rowStep[direction], c += columnStep[direction]) {
+                    const int to = r * N + c;
+                    tables.between[from][to] = passed;
+                    passed |= squareBit(r, c);
+                }
+            }
+        }
+        return tables;
+    }
+
+    inline constexpr Tables TABLES = makeTables();
+
+    /**
+     * @brief Rook moves along one ray: every square up to and including the first occupied one.
+     * @param direction The ray to follow
+     * @param square The square the rook stands on
+     * @param occupied Every occupied square
+     * @return The reachable squares, before removing the rook's own pieces
+     */
+    inline Bitboard rayAttacks(Direction direction, int square, Bitboard occupied) {
+        const Bitboard ray = TABLES.ray[direction][square];
+        const Bitboard blockers = ray & occupied;
+        if (blockers == 0) {
+            return ray;
+        }
+        const int first = direction == UP || direction == RIGHT ? BitUtil::lsb(blockers) : BitUtil::msb(blockers);
+        return ray ^ TABLES.ray[direction][first];
+    }
+
+    /**
+     * @brief Rook moves in all four directions.
+     * @param square The square the rook stands on
+     * @param occupied Every occupied square
+     * @return The reachable squares, before removing the rook's own pieces
+     */
+    inline Bitboard rookAttacks(int square, Bitboard occupied) {
+        return rayAttacks(UP, square, occupied) | rayAttacks(DOWN, square, occupied)
+               | rayAttacks(RIGHT, square, occupied) | rayAttacks(LEFT, square, occupied);
+    }
+}
+
+
+#endif //CHESS_BOARD_TABLES_HPP
@@ -0,0 +1,84 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file CastleJoin.cpp
+ * @brief This file contains the implementation of the bulk castle join.
+ */
+
+#include "CastleJoin.hpp"
+#include "PieceOrder.hpp"
+
+/**
+ * @brief Sorts the on-board pieces by (color, row, column) with PieceOrder::order.
+ *        Pieces that are not on the board are left out.
+ * @param pieces A const reference to the pieces to sort
+ * @return The indices of the on-board pieces in sorted order. The sort is stable, so ties
+ *         keep their input order.
+ */
+std::vector<std::size_t> CastleJoin::sortBySquare(const std::vector<PieceRecord> &pieces) {
+    return sortBySquare(pieces.data(), pieces.size());
+}
+
+std::vector<std::size_t> CastleJoin::sortBySquare(const PieceRecord *pieces, std::size_t count) {
+    std::vector<std::size_t> sorted;
+    sorted.resize(PieceOrder::order(pieces, count, sorted));
+    return sorted;
+}
+
+/**
+ * @brief Finds every pair (i, j), i != j, for which pieces[i].canCastle(pieces[j]) is true,
+ *        ie. exactly the pairs Rook::canCastle accepts when called on every pair.
+ * @param pieces A const reference to the pieces to join. Any kind may act as a partner;
+ *        only records of kind ROOK act as the rook side.
+ * @return The matching pairs, grouped by (color, row) bucket and ordered by column
+ *         inside each bucket
+ */
+std::vector<CastlePair> CastleJoin::findPairs(const std::vector<PieceRecord> &pieces) {
+    return findPairs(pieces.data(), pieces.size());
+}
+
+/**
+ * @brief Same as findPairs(pieces), over a plain array of records (eg. memory owned by a caller
+ *        in another language).
+ * @param pieces A pointer to the first record
+ * @param count The number of records
+ */
+std::vector<CastlePair> CastleJoin::findPairs(const PieceRecord *pieces, std::size_t count) {
+    std::vector<CastlePair> pairs;
+    std::vector<std::size_t> sorted = sortBySquare(pieces, count);
+
+    std::size_t bucketStart = 0;
+    while (bucketStart < sorted.size()) {
+        const PieceRecord &first = pieces[sorted[bucketStart]];
+        std::size_t bucketEnd = bucketStart + 1;
+        while (bucketEnd < sorted.size()
+               && pieces[sorted[bucketEnd]].color == first.color
+               && pieces[sorted[bucketEnd]].row == first.row) {
+            ++bucketEnd;
+        }
+
+        // Inside a bucket the columns only grow, so the window [low, high) of pieces within
+        // one column of the current rook only ever moves forward
+        std::size_t low = bucketStart;
+        std::size_t high = bucketStart;
+        for (std::size_t k = bucketStart; k < bucketEnd; ++k) {
+            const PieceRecord &rook = pieces[sorted[k]];
+            while (pieces[sorted[low]].column < rook.column - 1) {
+                ++low;
+            }
+            while (high < bucketEnd && pieces[sorted[high]].column <= rook.column + 1) {
+                ++high;
+            }
+            if (rook.kind != PieceKind::ROOK || rook.castleMovesLeft <= 0) {
+                continue;
+            }
+            for (std::size_t j = low; j < high; ++j) {
+                if (j != k) {
+                    pairs.push_back({sorted[k], sorted[j]});
+                }
+            }
+        }
+        bucketStart = bucketEnd;
+    }
+    return pairs;
+}
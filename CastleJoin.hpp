@@ -0,0 +1,59 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file CastleJoin.hpp
+ * @brief This file declares the bulk castle join, which finds every (rook, partner) pair
+ *        for which Rook::canCastle holds in a large set of pieces.
+ *
+ * Instead of calling canCastle on all n * n pairs, the on-board pieces are radix sorted by
+ * (color, row, column). Pieces that can castle together then sit in the same (color, row)
+ * bucket within one column of each other, so a sliding window over each bucket emits every
+ * pair in O(n + pairs).
+ */
+
+#ifndef CHESS_CASTLE_JOIN_HPP
+#define CHESS_CASTLE_JOIN_HPP
+
+
+#include <cstddef>
+#include <vector>
+#include "PieceRecord.hpp"
+
+struct CastlePair {
+    std::size_t rook;       // Index of the rook in the input
+    std::size_t partner;    // Index of the piece the rook can castle with
+};
+
+namespace CastleJoin {
+
+    /**
+     * @brief Finds every pair (i, j), i != j, for which pieces[i].canCastle(pieces[j]) is true,
+     *        ie. exactly the pairs Rook::canCastle accepts when called on every pair.
+     * @param pieces A const reference to the pieces to join. Any kind may act as a partner;
+     *        only records of kind ROOK act as the rook side.
+     * @return The matching pairs, grouped by (color, row) bucket and ordered by column
+     *         inside each bucket
+     */
+    std::vector<CastlePair> findPairs(const std::vector<PieceRecord> &pieces);
+
+    /**
+     * @brief Same as findPairs(pieces), over a plain array of records (eg. memory owned by a caller
+     *        in another language).
+     * @param pieces A pointer to the first record
+     * @param count The number of records
+     */
+    std::vector<CastlePair> findPairs(const PieceRecord *pieces, std::size_t count);
+
+    /**
+     * @brief Sorts the on-board pieces by (color, row, column) with PieceOrder::order.
+     *        Pieces that are not on the board are left out.
+     * @param pieces A const reference to the pieces to sort
+     * @return The indices of the on-board pieces in sorted order. The sort is stable, so ties
+     *         keep their input order.
+     */
+    std::vector<std::size_t> sortBySquare(const std::vector<PieceRecord> &pieces);
+    std::vector<std::size_t> sortBySquare(const PieceRecord *pieces, std::size_t count);
+}
+
+
+#endif //CHESS_CASTLE_JOIN_HPP
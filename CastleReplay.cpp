@@ -0,0 +1,47 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file CastleReplay.cpp
+ * @brief This file contains the implementation of the batch castle operations.
+ */
+
+#include "CastleReplay.hpp"
+
+/**
+ * @brief Executes the castles in order. Each castle is checked against the pieces as left
+ *        by the castles before it, so a rook that runs out of castle moves stops castling.
+ * @param pieces A reference to the pieces the castles index into
+ * @param castles A const reference to the castles to execute
+ * @param applied A reference to a vector that receives one flag per castle:
+ *        1 if the castle was made, 0 if Rook::canCastle rejected it
+ * @return The number of castles made
+ */
+std::size_t CastleReplay::apply(std::vector<PieceRecord> &pieces, const std::vector<CastlePair> &castles,
+                                std::vector<std::uint8_t> &applied) {
+    applied.assign(castles.size(), 0);
+    std::size_t made = 0;
+    for (std::size_t i = 0; i < castles.size(); ++i) {
+        const CastlePair &castle = castles[i];
+        if (pieces[castle.rook].castle(pieces[castle.partner])) {
+            applied[i] = 1;
+            ++made;
+        }
+    }
+    return made;
+}
+
+/**
+ * @brief Rolls back a replay made with apply(), undoing the castles in reverse order.
+ * @param pieces A reference to the pieces, as left by apply()
+ * @param castles A const reference to the castles passed to apply()
+ * @param applied A const reference to the flags filled in by apply()
+ * @post The pieces are back to their state from before apply()
+ */
+void CastleReplay::undo(std::vector<PieceRecord> &pieces, const std::vector<CastlePair> &castles,
+                        const std::vector<std::uint8_t> &applied) {
+    for (std::size_t i = castles.size(); i-- > 0;) {
+        if (applied[i]) {
+            pieces[castles[i].rook].undoCastle(pieces[castles[i].partner]);
+        }
+    }
+}
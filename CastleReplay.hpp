@@ -0,0 +1,48 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file CastleReplay.hpp
+ * @brief This file declares the batch castle operations used by replay pipelines.
+ *
+ * A replay is a list of (rook, partner) index pairs into an array of PieceRecords. The castles
+ * are executed in order with the same rule as Rook::castle, and a replay that was applied can
+ * be rolled back with undo().
+ */
+
+#ifndef CHESS_CASTLE_REPLAY_HPP
+#define CHESS_CASTLE_REPLAY_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CastleJoin.hpp"
+#include "PieceRecord.hpp"
+
+namespace CastleReplay {
+
+    /**
+     * @brief Executes the castles in order. Each castle is checked against the pieces as left
+     *        by the castles before it, so a rook that runs out of castle moves stops castling.
+     * @param pieces A reference to the pieces the castles index into
+     * @param castles A const reference to the castles to execute
+     * @param applied A reference to a vector that receives one flag per castle:
+     *        1 if the castle was made, 0 if Rook::canCastle rejected it
+     * @return The number of castles made
+     */
+    std::size_t apply(std::vector<PieceRecord> &pieces, const std::vector<CastlePair> &castles,
+                      std::vector<std::uint8_t> &applied);
+
+    /**
+     * @brief Rolls back a replay made with apply(), undoing the castles in reverse order.
+     * @param pieces A reference to the pieces, as left by apply()
+     * @param castles A const reference to the castles passed to apply()
+     * @param applied A const reference to the flags filled in by apply()
+     * @post The pieces are back to their state from before apply()
+     */
+    void undo(std::vector<PieceRecord> &pieces, const std::vector<CastlePair> &castles,
+              const std::vector<std::uint8_t> &applied);
+}
+
+
+#endif //CHESS_CASTLE_REPLAY_HPP
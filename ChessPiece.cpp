@@ -203,4 +203,60 @@ void ChessPiece::display() {
     }
 }
 
+/**
+ * @brief Compares two chess pieces attribute by attribute.
+ * @param other A const reference to the piece to compare with
+ * @return True if the color, row, column and direction all match. False otherwise.
+ */
+bool ChessPiece::operator==(const ChessPiece &other) const {
+    return row_ == other.row_ && column_ == other.column_ && movingUp_ == other.movingUp_ && color_ == other.color_;
+}
+
+bool ChessPiece::operator!=(const ChessPiece &other) const {
+    return !(*this == other);
+}
 
+/**
+ * @brief Orders chess pieces by color, then row, column and direction (DOWN before UP),
+ *        so sorting groups the pieces of each color in board order.
+ * @param other A const reference to the piece to compare with
+ * @return True if this piece comes first. False otherwise.
+ */
+bool ChessPiece::operator<(const ChessPiece &other) const {
+    const int order = color_.compare(other.color_);
+    if (order != 0) {
+        return order < 0;
+    }
+    if (row_ != other.row_) {
+        return row_ < other.row_;
+    }
+    if (column_ != other.column_) {
+        return column_ < other.column_;
+    }
+    return movingUp_ < other.movingUp_;
+}
+
+/**
+ * @brief Hashes the color, square and direction. The bits are fully mixed, so pieces on
+ *        neighbouring squares land in unrelated buckets. std::hash<ChessPiece> calls it.
+ * @return The hash value
+ */
+std::size_t ChessPiece::hash() const {
+    // Rows and columns are in [-1, BOARD_LENGTH), so shifting them by one keeps every field apart
+    const std::uint64_t square = static_cast<std::uint64_t>(row_ + 1) << 16 | static_cast<std::uint64_t>(column_ + 1) << 8;
+    return combine(std::hash<std::string>()(color_), square | movingUp_);
+}
+
+/**
+ * @brief Mixes a value into a hash, eg. the state a subclass adds to ChessPiece::hash().
+ * @param seed The hash so far
+ * @param value The value to mix in
+ * @return The combined hash
+ */
+std::size_t ChessPiece::combine(std::size_t seed, std::uint64_t value) {
+    // The SplitMix64 finalizer: every input bit affects every output bit
+    std::uint64_t mixed = static_cast<std::uint64_t>(seed) ^ (value * 0x9E3779B97F4A7C15ULL);
+    mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<std::size_t>(mixed ^ (mixed >> 31));
+}
@@ -17,6 +17,9 @@
 #define CHESS_PIECE_HPP
 
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 
 class ChessPiece {
@@ -132,7 +135,48 @@ public:
        WHITE piece is not on the board
  */
     void display();
+
+    /**
+     * @brief Compares two chess pieces attribute by attribute.
+     * @param other A const reference to the piece to compare with
+     * @return True if the color, row, column and direction all match. False otherwise.
+     */
+    bool operator==(const ChessPiece &other) const;
+    bool operator!=(const ChessPiece &other) const;
+
+    /**
+     * @brief Orders chess pieces by color, then row, column and direction (DOWN before UP),
+     *        so sorting groups the pieces of each color in board order.
+     * @param other A const reference to the piece to compare with
+     * @return True if this piece comes first. False otherwise.
+     */
+    bool operator<(const ChessPiece &other) const;
+
+    /**
+     * @brief Hashes the color, square and direction. The bits are fully mixed, so pieces on
+     *        neighbouring squares land in unrelated buckets. std::hash<ChessPiece> calls it.
+     * @return The hash value
+     */
+    std::size_t hash() const;
+
+protected:
+    /**
+     * @brief Mixes a value into a hash, eg. the state a subclass adds to ChessPiece::hash().
+     * @param seed The hash so far
+     * @param value The value to mix in
+     * @return The combined hash
+     */
+    static std::size_t combine(std::size_t seed, std::uint64_t value);
 };
 
+namespace std {
+    template <>
+    struct hash<ChessPiece> {
+        std::size_t operator()(const ChessPiece &piece) const {
+            return piece.hash();
+        }
+    };
+}
+
 
 #endif //CHESS_PIECE_HPP
@@ -0,0 +1,105 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Endgame.cpp
+ * @brief This file contains the implementation of the specialized endgame evaluators and their
+ *        material-keyed dispatch table.
+ */
+
+#include "BitUtil.hpp"
+#include "BoardTables.hpp"
+#include "Endgame.hpp"
+
+namespace {
+    const int TABLE_BITS = 4;
+    const int TABLE_SIZE = 1 << TABLE_BITS;
+
+    struct Table {
+        Endgame::Entry entries[TABLE_SIZE];
+    };
+
+    constexpr int slotOf(std::uint32_t key) {
+        return static_cast<int>((key * 0x9E3779B1U) >> (32 - TABLE_BITS));
+    }
+
+    // Linear probing; the table stays far from full, so a lookup rarely needs a second probe
+    constexpr void insert(Table &table, std::uint32_t key, Endgame::Evaluator evaluate, int strongSide) {
+        int slot = slotOf(key);
+        while (table.entries[slot].key != 0) {
+            slot = (slot + 1) & (TABLE_SIZE - 1);
+        }
+        table.entries[slot] = Endgame::Entry{key, evaluate, strongSide};
+    }
+
+    constexpr Table makeTable() {
+        Table table{};
+        for (int strong = 0; strong < 2; ++strong) {
+            insert(table, Endgame::signature(strong, 0, 1, 1) | Endgame::signature(strong ^ 1, 0, 0, 1),
+                   &Endgame::rookEnding, strong);
+        }
+        return table;
+    }
+
+    constexpr Table TABLE = makeTable();
+}
+
+/**
+ * @param board A const reference to the position
+ * @return Its material key, the signature of WHITE ORed with the signature of BLACK
+ */
+std::uint32_t Endgame::materialKey(const Board &board) {
+    std::uint32_t key = 0;
+    for (int side = 0; side < 2; ++side) {
+        key |= signature(side, BitUtil::popcount(board.pieces(side, PieceKind::PAWN)),
+                         BitUtil::popcount(board.pieces(side, PieceKind::ROOK)),
+                         BitUtil::popcount(board.pieces(side, PieceKind::PIECE)));
+    }
+    return key;
+}
+
+/**
+ * @param key A material key
+ * @return The entry registered for it, or nullptr if there is none
+ */
+const Endgame::Entry *Endgame::find(std::uint32_t key) {
+    if (key == 0) {
+        return nullptr;
+    }
+    for (int slot = slotOf(key); TABLE.entries[slot].key != 0; slot = (slot + 1) & (TABLE_SIZE - 1)) {
+        if (TABLE.entries[slot].key == key) {
+            return &TABLE.entries[slot];
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Evaluates the position with a specialized evaluator if its material has one.
+ * @param board A const reference to the position
+ * @param score A reference that receives the score for the side to move
+ * @return True if an evaluator was found. False otherwise, and score is not modified.
+ */
+bool Endgame::evaluate(const Board &board, int &score) {
+    const Entry *entry = find(materialKey(board));
+    if (entry == nullptr) {
+        return false;
+    }
+    score = entry->evaluate(board, entry->strongSide);
+    return true;
+}
+
+/**
+ * @brief The rook ending: a rook and a generic piece for strongSide against a lone generic piece.
+ * @param board The position
+ * @param strongSide The side with the rook
+ * @return WIN - 1 if strongSide is to move and its rook can take the lone piece, else 0 (a draw)
+ */
+int Endgame::rookEnding(const Board &board, int strongSide) {
+    // The lone piece cannot move, so the defender to move is out of moves: a draw
+    if (board.sideToMove() != strongSide || board.pliesSinceProgress() >= Board::DRAW_PLIES) {
+        return 0;
+    }
+    const int rook = BitUtil::lsb(board.pieces(strongSide, PieceKind::ROOK));
+    const Bitboard target = board.pieces(strongSide ^ 1, PieceKind::PIECE);
+    return (BoardTables::rookAttacks(rook, board.occupied()) & target) ? WIN - 1 : 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Endgame.hpp
+ * @brief This file declares the specialized endgame evaluators and the material-keyed table that
+ *        dispatches to them.
+ *
+ * A position's material key packs the number of pieces of each side and kind; the evaluators are
+ * registered under the keys of the material they know, once for each side as the stronger one, in
+ * a small open-addressed table built by the compiler. Looking a position up costs six popcounts
+ * and usually one probe, so a search can ask on every node.
+ *
+ * The rook ending: a rook and a generic piece against a lone generic piece, the counterpart of
+ * king and rook against king (the generic piece standing in for the king). Generic pieces never
+ * move, so the lone piece cannot run from the edge or be mated slowly: the defender to move has no
+ * legal move and the game is drawn, and the attacker to move wins exactly when the rook can take
+ * the lone piece at once. Any other rook move hands the defender a position with no legal move.
+ */
+
+#ifndef CHESS_ENDGAME_HPP
+#define CHESS_ENDGAME_HPP
+
+
+#include <cstdint>
+#include "Board.hpp"
+
+namespace Endgame {
+
+    // The score of a won position for the side to move; a win in n plies scores WIN - n
+    const int WIN = 30000;
+
+    /**
+     * @brief A specialized evaluator.
+     * @param board The position, whose material matches the evaluator's
+     * @param strongSide The side the evaluator was registered for as the stronger one
+     * @return The score for the side to move, in centipawns or relative to WIN
+     */
+    typedef int (*Evaluator)(const Board &board, int strongSide);
+
+    struct Entry {
+        std::uint32_t key;          // 0 for an empty slot
+        Evaluator evaluate;
+        int strongSide;
+    };
+
+    /**
+     * @brief Packs a material signature. Each count takes 4 bits and saturates at 15.
+     * @param side WHITE or BLACK
+     * @param pawns The number of pawns of that side
+     * @param rooks The number of rooks of that side
+     * @param pieces The number of generic pieces of that side
+     * @return The side's part of a material key; OR both sides together
+     */
+    constexpr std::uint32_t signature(int side, int pawns, int rooks, int pieces) {
+        const int shift = side * 12;
+        return (static_cast<std::uint32_t>(pawns < 15 ? pawns : 15) << shift)
+               | (static_cast<std::uint32_t>(rooks < 15 ? rooks : 15) << (shift + 4))
+               | (static_cast<std::uint32_t>(pieces < 15 ? pieces : 15) << (shift + 8));
+    }
+
+    /**
+     * @param board A const reference to the position
+     * @return Its material key, the signature of WHITE ORed with the signature of BLACK
+     */
+    std::uint32_t materialKey(const Board &board);
+
+    /**
+     * @param key A material key
+     * @return The entry registered for it, or nullptr if there is none
+     */
+    const Entry *find(std::uint32_t key);
+
+    /**
+     * @brief Evaluates the position with a specialized evaluator if its material has one.
+     * @param board A const reference to the position
+     * @param score A reference that receives the score for the side to move
+     * @return True if an evaluator was found. False otherwise, and score is not modified.
+     */
+    bool evaluate(const Board &board, int &score);
+
+    /**
+     * @brief The rook ending: a rook and a generic piece for strongSide against a lone generic piece.
+     * @param board The position
+     * @param strongSide The side with the rook
+     * @return WIN - 1 if strongSide is to move and its rook can take the lone piece, else 0 (a draw)
+     */
+    int rookEnding(const Board &board, int strongSide);
+}
+
+
+#endif //CHESS_ENDGAME_HPP
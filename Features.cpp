@@ -0,0 +1,150 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Features.cpp
+ * @brief This file contains the implementation of the evaluation feature extraction.
+ */
+
+#include "BitUtil.hpp"
+#include "BoardTables.hpp"
+#include "Features.hpp"
+
+namespace {
+    const int N = ChessPiece::BOARD_LENGTH;
+    const Bitboard FIRST_COLUMN = 0x0101010101010101ULL;
+    const int PAWN = static_cast<int>(PieceKind::PAWN);
+    const int ROOK = static_cast<int>(PieceKind::ROOK);
+
+    // ROW_BITS[k] holds the rows whose index has bit k set, so the rows of a set of squares
+    // sum to the popcounts of the set under each mask, weighted by 1, 2 and 4
+    const Bitboard ROW_BITS[3] = {0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+
+    int rowSum(Bitboard squares) {
+        return BitUtil::popcount(squares & ROW_BITS[0]) + 2 * BitUtil::popcount(squares & ROW_BITS[1])
+               + 4 * BitUtil::popcount(squares & ROW_BITS[2]);
+    }
+
+    // The columns holding at least one of the squares, as the low byte
+    Bitboard columnsOf(Bitboard squares) {
+        squares |= squares >> 32;
+        squares |= squares >> 16;
+        squares |= squares >> 8;
+        return squares & 0xFF;
+    }
+
+    // The whole columns of a column byte
+    Bitboard spread(Bitboard columns) {
+        return columns * FIRST_COLUMN;
+    }
+
+    int advance(Bitboard pieces, Bitboard movingUp) {
+        const Bitboard down = pieces & ~movingUp;
+        return rowSum(pieces & movingUp) + (N - 1) * BitUtil::popcount(down) - rowSum(down);
+    }
+}
+
+/**
+ * @brief Computes the features of one position.
+ * @param board A const reference to the position
+ * @param row A pointer to WIDTH values that receive its features
+ */
+void Features::extract(const Board &board, std::int16_t *row) {
+    const Bitboard occupied = board.occupied();
+    const Bitboard movingUp = board.movingUp();
+    const Bitboard pawns[2] = {board.pieces(PieceRecord::WHITE, PieceKind::PAWN),
+                               board.pieces(PieceRecord::BLACK, PieceKind::PAWN)};
+    const Bitboard pawnColumns[2] = {spread(columnsOf(pawns[0])), spread(columnsOf(pawns[1]))};
+
+    for (int side = 0; side < 2; ++side) {
+        const Bitboard own = board.occupied(side);
+        const Bitboard rooks = board.pieces(side, PieceKind::ROOK);
+        const Bitboard enemyColumns = pawnColumns[side ^ 1] & ~pawnColumns[side];
+
+        int mobility = 0;
+        for (Bitboard remaining = rooks; remaining; ) {
+            mobility += BitUtil::popcount(BoardTables::rookAttacks(BitUtil::popLsb(remaining), occupied) & ~own);
+        }
+
+        std::int16_t *values = row + side * COLUMNS;
+        values[PAWNS] = static_cast<std::int16_t>(BitUtil::popcount(pawns[side]));
+        values[PAWN_ADVANCE] = static_cast<std::int16_t>(advance(pawns[side], movingUp));
+        values[ROOKS] = static_cast<std::int16_t>(BitUtil::popcount(rooks));
+        values[ROOK_MOBILITY] = static_cast<std::int16_t>(mobility);
+        values[ROOK_OPEN_FILE] = static_cast<std::int16_t>(BitUtil::popcount(rooks & ~(pawnColumns[0] | pawnColumns[1])));
+        values[ROOK_HALF_OPEN_FILE] = static_cast<std::int16_t>(BitUtil::popcount(rooks & enemyColumns));
+        values[PIECES] = static_cast<std::int16_t>(BitUtil::popcount(board.pieces(side, PieceKind::PIECE)));
+    }
+}
+
+/**
+ * @brief Computes the features of many positions.
+ * @param boards A pointer to the first position
+ * @param count The number of positions
+ * @param matrix A pointer to count * WIDTH values that receive one row per position
+ */
+void Features::extract(const Board *boards, std::size_t count, std::int16_t *matrix) {
+    for (std::size_t i = 0; i < count; ++i) {
+        extract(boards[i], matrix + i * WIDTH);
+    }
+}
+
+/**
+ * @brief Same as extract(boards, count, matrix), into a vector.
+ * @param boards A const reference to the positions
+ * @param matrix A reference to a vector that receives the rows (it is resized)
+ */
+void Features::extract(const std::vector<Board> &boards, std::vector<std::int16_t> &matrix) {
+    matrix.resize(boards.size() * WIDTH);
+    extract(boards.data(), boards.size(), matrix.data());
+}
+
+/**
+ * @brief Computes the features of every piece of a position, in square order.
+ * @param board A const reference to the position
+ * @param matrix A reference to a vector the rows are appended to
+ * @return The number of rows appended, ie. the number of pieces
+ */
+std::size_t Features::extractPieces(const Board &board, std::vector<std::int8_t> &matrix) {
+    const BoardTables::Tables &tables = BoardTables::TABLES;
+    const Bitboard occupied = board.occupied();
+    const Bitboard movingUp = board.movingUp();
+    const Bitboard pawnColumns[2] = {spread(columnsOf(board.pieces(PieceRecord::WHITE, PieceKind::PAWN))),
+                                     spread(columnsOf(board.pieces(PieceRecord::BLACK, PieceKind::PAWN)))};
+
+    const std::size_t rows = static_cast<std::size_t>(BitUtil::popcount(occupied));
+    const std::size_t first = matrix.size();
+    matrix.resize(first + rows * PIECE_COLUMNS);
+    std::int8_t *values = matrix.data() + first;
+    for (Bitboard remaining = occupied; remaining; values += PIECE_COLUMNS) {
+        const int square = BitUtil::popLsb(remaining);
+        const Bitboard bit = Bitboard(1) << square;
+        const int side = board.sideAt(square);
+        const int kind = board.kindAt(square);
+        const int up = (movingUp & bit) != 0;
+
+        int mobility = 0;
+        if (kind == ROOK) {
+            mobility = BitUtil::popcount(BoardTables::rookAttacks(square, occupied) & ~board.occupied(side));
+        } else if (kind == PAWN) {
+            const Bitboard single = tables.pawnPush[up][square] & ~occupied;
+            const Bitboard twice = single && (board.doubleJumpers() & bit) ? tables.pawnDoublePush[up][square] & ~occupied : 0;
+            mobility = BitUtil::popcount(single | twice | (tables.pawnCapture[up][square] & board.occupied(side ^ 1)));
+        }
+
+        int fileStatus = 2;
+        if (pawnColumns[side] & bit) {
+            fileStatus = 0;
+        } else if (pawnColumns[side ^ 1] & bit) {
+            fileStatus = 1;
+        }
+
+        const int row = square / N;
+        values[SQUARE] = static_cast<std::int8_t>(square);
+        values[SIDE] = static_cast<std::int8_t>(side);
+        values[KIND] = static_cast<std::int8_t>(kind);
+        values[MOBILITY] = static_cast<std::int8_t>(mobility);
+        values[FILE_STATUS] = static_cast<std::int8_t>(fileStatus);
+        values[ADVANCE] = static_cast<std::int8_t>(up ? row : N - 1 - row);
+    }
+    return rows;
+}
@@ -0,0 +1,92 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Features.hpp
+ * @brief This file declares the evaluation feature extraction: rook mobility, open and half-open
+ *        files, and pawn advancement, computed from the bitboards of many positions at once.
+ *
+ * Every feature is a population count over masked bitboards. The files holding pawns are folded
+ * into one byte and spread back over the board with a multiply, so counting the rooks on open
+ * files takes a handful of instructions, and the rows of the pawns are summed from three
+ * bit-sliced popcounts instead of one getRow() per pawn. Only rook mobility walks the rooks, one
+ * attack set each. Built with -mpopcnt -mbmi (or -march=native) the loops use the POPCNT, TZCNT
+ * and BLSR instructions.
+ *
+ * The results are dense row-major matrices of small integers, ready to be fed to a tuner.
+ */
+
+#ifndef CHESS_FEATURES_HPP
+#define CHESS_FEATURES_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Board.hpp"
+
+namespace Features {
+
+    /**
+     * @brief The features of one side of a position. A position row holds the WHITE features
+     *        followed by the BLACK ones, so column side * COLUMNS + feature.
+     */
+    enum Column {
+        PAWNS = 0,              // Number of pawns
+        PAWN_ADVANCE = 1,       // Rows the pawns have advanced from their back edge, summed
+        ROOKS = 2,              // Number of rooks, including promoted pawns
+        ROOK_MOBILITY = 3,      // Squares the rooks can move to (empty or enemy), summed
+        ROOK_OPEN_FILE = 4,     // Rooks on a column with no pawn
+        ROOK_HALF_OPEN_FILE = 5,    // Rooks on a column with enemy pawns only
+        PIECES = 6,             // Number of generic pieces
+        COLUMNS = 7
+    };
+
+    // The number of values in a position row
+    const int WIDTH = 2 * COLUMNS;
+
+    /**
+     * @brief The per-piece features. A piece row holds one value per PieceColumn.
+     */
+    enum PieceColumn {
+        SQUARE = 0,             // row * BOARD_LENGTH + column
+        SIDE = 1,               // WHITE or BLACK
+        KIND = 2,               // The PieceKind
+        MOBILITY = 3,           // Squares the piece can move to, not counting castles
+        FILE_STATUS = 4,        // 0 if its own side has a pawn on its column, 1 if only the enemy has, 2 if none
+        ADVANCE = 5,            // Rows from its back edge: getRow() moving up, BOARD_LENGTH - 1 - getRow() moving down
+        PIECE_COLUMNS = 6
+    };
+
+    /**
+     * @brief Computes the features of one position.
+     * @param board A const reference to the position
+     * @param row A pointer to WIDTH values that receive its features
+     */
+    void extract(const Board &board, std::int16_t *row);
+
+    /**
+     * @brief Computes the features of many positions.
+     * @param boards A pointer to the first position
+     * @param count The number of positions
+     * @param matrix A pointer to count * WIDTH values that receive one row per position
+     */
+    void extract(const Board *boards, std::size_t count, std::int16_t *matrix);
+
+    /**
+     * @brief Same as extract(boards, count, matrix), into a vector.
+     * @param boards A const reference to the positions
+     * @param matrix A reference to a vector that receives the rows (it is resized)
+     */
+    void extract(const std::vector<Board> &boards, std::vector<std::int16_t> &matrix);
+
+    /**
+     * @brief Computes the features of every piece of a position, in square order.
+     * @param board A const reference to the position
+     * @param matrix A reference to a vector the rows are appended to
+     * @return The number of rows appended, ie. the number of pieces
+     */
+    std::size_t extractPieces(const Board &board, std::vector<std::int8_t> &matrix);
+}
+
+
+#endif //CHESS_FEATURES_HPP
@@ -0,0 +1,274 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file HashMemory.cpp
+ * @brief This file contains the implementation of the HashMemory class.
+ *
+ * NUMA placement goes through the mbind system call directly rather than libnuma, so there is
+ * nothing extra to link against. Everything but the heap fallback is Linux only.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+#include "HashMemory.hpp"
+
+#if defined(__linux__)
+#include <fstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const std::size_t HUGE_PAGE = 2 * 1024 * 1024;
+    const std::size_t HEAP_ALIGNMENT = 64;
+
+    std::size_t roundUp(std::size_t value, std::size_t unit) {
+        return (value + unit - 1) / unit * unit;
+    }
+
+#if defined(__linux__)
+    // From <linux/mempolicy.h>, which is not always installed
+    const int MPOL_PREFERRED_MODE = 1;
+    const int MPOL_INTERLEAVE_MODE = 3;
+    const int MAX_NODES = 64;
+
+    // Reads /sys/devices/system/node/online, eg. "0-1" or "0,2-3", into a bit mask
+    std::uint64_t onlineNodes() {
+        std::ifstream file("/sys/devices/system/node/online");
+        std::string text;
+        if (!std::getline(file, text)) {
+            return 1;
+        }
+        std::uint64_t mask = 0;
+        std::size_t position = 0;
+        while (position < text.size()) {
+            std::size_t end = text.find(',', position);
+            if (end == std::string::npos) {
+                end = text.size();
+            }
+            std::string range = text.substr(position, end - position);
+            std::size_t dash = range.find('-');
+            int first = std::atoi(range.c_str());
+            int last = dash == std::string::npos ? first : std::atoi(range.c_str() + dash + 1);
+            for (int node = first; node <= last && node < MAX_NODES; ++node) {
+                if (node >= 0) {
+                    mask |= std::uint64_t(1) << node;
+                }
+            }
+            position = end + 1;
+        }
+        return mask != 0 ? mask : 1;
+    }
+
+    bool bind(void *address, std::size_t bytes, int mode, std::uint64_t nodes) {
+        return syscall(SYS_mbind, address, bytes, mode, &nodes, MAX_NODES + 1, 0) == 0;
+    }
+
+    // Applies the policy before the memory is first touched; returns the nodes used
+    int place(void *address, std::size_t bytes, HashMemory::NumaPolicy policy) {
+        const std::uint64_t nodes = onlineNodes();
+        const int count = __builtin_popcountll(nodes);
+        if (policy == HashMemory::LOCAL || count < 2) {
+            return 1;
+        }
+        if (policy == HashMemory::INTERLEAVE) {
+            return bind(address, bytes, MPOL_INTERLEAVE_MODE, nodes) ? count : 1;
+        }
+
+        // PARTITION: slice i prefers the i-th online node
+        const std::size_t slice = roundUp(bytes / count, HUGE_PAGE);
+        char *start = static_cast<char *>(address);
+        int slices = 0;
+        std::uint64_t remaining = nodes;
+        for (std::size_t offset = 0; offset < bytes && remaining != 0; offset += slice) {
+            std::uint64_t node = remaining & (0 - remaining);
+            remaining &= remaining - 1;
+            std::size_t length = remaining == 0 ? bytes - offset : std::min(slice, bytes - offset);
+            if (!bind(start + offset, length, MPOL_PREFERRED_MODE, node)) {
+                return 1;
+            }
+            ++slices;
+        }
+        return slices;
+    }
+
+    // An anonymous mapping aligned to a huge page, so transparent huge pages can back all of it
+    void *mapAligned(std::size_t bytes) {
+        void *raw = mmap(nullptr, bytes + HUGE_PAGE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (raw == MAP_FAILED) {
+            return nullptr;
+        }
+        std::uintptr_t start = reinterpret_cast<std::uintptr_t>(raw);
+        std::uintptr_t aligned = roundUp(start, HUGE_PAGE);
+        if (aligned > start) {
+            munmap(raw, aligned - start);
+        }
+        std::size_t tail = start + bytes + HUGE_PAGE - (aligned + bytes);
+        if (tail > 0) {
+            munmap(reinterpret_cast<void *>(aligned + bytes), tail);
+        }
+        return reinterpret_cast<void *>(aligned);
+    }
+#endif
+}
+
+/**
+ * @brief Default Constructor. Holds nothing.
+ */
+HashMemory::HashMemory() : data_(nullptr), size_(0), mapped_(0), backing_(NONE), numaNodes_(1) {
+}
+
+/**
+ * @brief Parameterized constructor. Allocates zeroed memory, using the best backing available.
+ * @param bytes The number of bytes
+ * @param options Whether to try huge pages and how to place the memory on NUMA nodes
+ * @throws std::bad_alloc if not even the heap can provide the memory
+ */
+HashMemory::HashMemory(std::size_t bytes, const Options &options) : HashMemory() {
+    if (bytes == 0) {
+        return;
+    }
+    size_ = bytes;
+
+#if defined(__linux__)
+    // Blocks under one huge page gain nothing from a mapping of their own and go to the heap.
+    // Reserved huge pages come first: they never fall apart into 4K pages, but are often not configured.
+    const std::size_t length = roundUp(bytes, HUGE_PAGE);
+#if defined(MAP_HUGETLB)
+    if (options.hugePages && bytes >= HUGE_PAGE) {
+        void *address = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (address != MAP_FAILED) {
+            data_ = address;
+            mapped_ = length;
+            backing_ = HUGETLB;
+        }
+    }
+#endif
+    if (data_ == nullptr && bytes >= HUGE_PAGE) {
+        data_ = mapAligned(length);
+        if (data_ != nullptr) {
+            mapped_ = length;
+            backing_ = options.hugePages && adviseHugePages(data_, length) ? TRANSPARENT : PAGES;
+        }
+    }
+    if (data_ != nullptr) {
+        numaNodes_ = place(data_, length, options.numa);
+        return;
+    }
+#else
+    (void) options;
+#endif
+
+    data_ = ::operator new(bytes, std::align_val_t(HEAP_ALIGNMENT));
+    std::memset(data_, 0, bytes);
+    backing_ = HEAP;
+}
+
+/**
+ * @brief Same as HashMemory(bytes, Options()): huge pages, interleaved over the NUMA nodes.
+ */
+HashMemory::HashMemory(std::size_t bytes) : HashMemory(bytes, Options()) {
+}
+
+HashMemory::HashMemory(HashMemory &&other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+          mapped_(std::exchange(other.mapped_, 0)), backing_(std::exchange(other.backing_, NONE)),
+          numaNodes_(std::exchange(other.numaNodes_, 1)) {
+}
+
+HashMemory &HashMemory::operator=(HashMemory &&other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_ = std::exchange(other.mapped_, 0);
+        backing_ = std::exchange(other.backing_, NONE);
+        numaNodes_ = std::exchange(other.numaNodes_, 1);
+    }
+    return *this;
+}
+
+/**
+ * @brief Destructor. Returns the memory the way it was obtained.
+ */
+HashMemory::~HashMemory() {
+    release();
+}
+
+/**
+ * @return The start of the memory, aligned to at least 64 bytes (nullptr if empty)
+ */
+void *HashMemory::data() const {
+    return data_;
+}
+
+/**
+ * @return The number of bytes asked for
+ */
+std::size_t HashMemory::size() const {
+    return size_;
+}
+
+/**
+ * @return How the memory is backed
+ */
+HashMemory::Backing HashMemory::backing() const {
+    return backing_;
+}
+
+/**
+ * @return The number of NUMA nodes the memory was spread over (1 if no policy was applied)
+ */
+int HashMemory::numaNodes() const {
+    return numaNodes_;
+}
+
+/**
+ * @brief Asks the kernel to back an existing mapping with transparent huge pages. Does nothing
+ *        where that is not supported.
+ * @param address The start of the mapping
+ * @param bytes The length of the mapping
+ * @return True if the advice was accepted. False otherwise.
+ */
+bool HashMemory::adviseHugePages(void *address, std::size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    return madvise(address, bytes, MADV_HUGEPAGE) == 0;
+#else
+    (void) address;
+    (void) bytes;
+    return false;
+#endif
+}
+
+/**
+ * @return The number of online NUMA nodes (1 on machines or systems without NUMA)
+ */
+int HashMemory::nodeCount() {
+#if defined(__linux__)
+    return __builtin_popcountll(onlineNodes());
+#else
+    return 1;
+#endif
+}
+
+void HashMemory::release() {
+    if (backing_ == HEAP) {
+        ::operator delete(data_, std::align_val_t(HEAP_ALIGNMENT));
+    }
+#if defined(__linux__)
+    else if (data_ != nullptr) {
+        munmap(data_, mapped_);
+    }
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = 0;
+    backing_ = NONE;
+    numaNodes_ = 1;
+}
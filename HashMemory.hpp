@@ -0,0 +1,119 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file HashMemory.hpp
+ * @brief This file declares HashMemory, the allocation layer behind the large hash tables
+ *        (the PerftTable, the MCTS node pool, ...).
+ *
+ * A large table probed at random misses the TLB on almost every access when it sits on 4K pages,
+ * and on a multi-socket machine memory allocated by one thread ends up on that thread's node.
+ * HashMemory asks the kernel for huge pages (MAP_HUGETLB, then transparent huge pages through
+ * madvise) and spreads the pages over the NUMA nodes with mbind, falling back one step at a time
+ * (to 4K pages, to a single node, to the heap) whenever something is not available or not
+ * permitted. Blocks smaller than a huge page simply come from the heap. The memory always
+ * starts out zeroed.
+ */
+
+#ifndef CHESS_HASH_MEMORY_HPP
+#define CHESS_HASH_MEMORY_HPP
+
+
+#include <cstddef>
+
+class HashMemory {
+public:
+    enum NumaPolicy {
+        LOCAL,          // Leave placement to the kernel (first touch)
+        INTERLEAVE,     // Spread the pages round-robin over every node
+        PARTITION       // Split the block into one contiguous slice per node, in node order
+    };
+
+    enum Backing {
+        NONE,           // Nothing is allocated
+        HEAP,           // Plain operator new
+        PAGES,          // An anonymous mapping on normal pages
+        TRANSPARENT,    // An anonymous mapping the kernel was asked to back with transparent huge pages
+        HUGETLB         // Reserved huge pages (MAP_HUGETLB)
+    };
+
+    struct Options {
+        bool hugePages = true;
+        NumaPolicy numa = INTERLEAVE;
+    };
+
+private:
+    void *data_;
+    std::size_t size_;          // The size asked for
+    std::size_t mapped_;        // The size of the mapping, 0 for the heap
+    Backing backing_;
+    int numaNodes_;             // The nodes the memory was placed on, 1 when no policy was applied
+
+public:
+    /**
+     * @brief Default Constructor. Holds nothing.
+     */
+    HashMemory();
+
+    /**
+     * @brief Parameterized constructor. Allocates zeroed memory, using the best backing available.
+     * @param bytes The number of bytes
+     * @param options Whether to try huge pages and how to place the memory on NUMA nodes
+     * @throws std::bad_alloc if not even the heap can provide the memory
+     */
+    HashMemory(std::size_t bytes, const Options &options);
+
+    /**
+     * @brief Same as HashMemory(bytes, Options()): huge pages, interleaved over the NUMA nodes.
+     */
+    explicit HashMemory(std::size_t bytes);
+
+    HashMemory(HashMemory &&other) noexcept;
+    HashMemory &operator=(HashMemory &&other) noexcept;
+    HashMemory(const HashMemory &) = delete;
+    HashMemory &operator=(const HashMemory &) = delete;
+
+    /**
+     * @brief Destructor. Returns the memory the way it was obtained.
+     */
+    ~HashMemory();
+
+    /**
+     * @return The start of the memory, aligned to at least 64 bytes (nullptr if empty)
+     */
+    void *data() const;
+
+    /**
+     * @return The number of bytes asked for
+     */
+    std::size_t size() const;
+
+    /**
+     * @return How the memory is backed
+     */
+    Backing backing() const;
+
+    /**
+     * @return The number of NUMA nodes the memory was spread over (1 if no policy was applied)
+     */
+    int numaNodes() const;
+
+    /**
+     * @brief Asks the kernel to back an existing mapping with transparent huge pages. Does nothing
+     *        where that is not supported.
+     * @param address The start of the mapping
+     * @param bytes The length of the mapping
+     * @return True if the advice was accepted. False otherwise.
+     */
+    static bool adviseHugePages(void *address, std::size_t bytes);
+
+    /**
+     * @return The number of online NUMA nodes (1 on machines or systems without NUMA)
+     */
+    static int nodeCount();
+
+private:
+    void release();
+};
+
+
+#endif //CHESS_HASH_MEMORY_HPP
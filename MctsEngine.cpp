@@ -0,0 +1,234 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file MctsEngine.cpp
+ * @brief This file contains the implementation of the MctsEngine class.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Endgame.hpp"
+#include "MctsEngine.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    // Results are kept in half points so they fit in integers: win 2, draw 1, loss 0
+    const int WIN = 2;
+    const int DRAW = 1;
+    const int LOSS = 0;
+
+    // How many playouts a thread runs between two looks at the clock
+    const int CLOCK_INTERVAL = 64;
+}
+
+/**
+ * @brief Parameterized constructor. Allocates the node pool once; it is reused by every search.
+ * @param options The search parameters
+ */
+MctsEngine::MctsEngine(const Options &options)
+        : options_(options), nodes_(nullptr), used_(0), started_(0), finished_(0) {
+    if (options_.nodeCapacity == 0) {
+        options_.nodeCapacity = 1;
+    }
+    memory_ = HashMemory(options_.nodeCapacity * sizeof(Node));
+    nodes_ = static_cast<Node *>(memory_.data());
+    std::uninitialized_default_construct_n(nodes_, options_.nodeCapacity);
+}
+
+/**
+ * @brief Searches the given position until the playout or time budget runs out.
+ * @param root A const reference to the position to search
+ * @return The chosen move and the search statistics
+ */
+MctsEngine::Report MctsEngine::search(const Board &root) {
+    resetNode(nodes_[0], Move());
+    used_.store(1);
+    started_.store(0);
+    finished_.store(0);
+
+    unsigned threadCount = options_.threads;
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+
+    Clock::time_point start = Clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < threadCount; ++t) {
+        threads.emplace_back(&MctsEngine::worker, this, std::cref(root), options_.seed + t);
+    }
+    worker(root, options_.seed);
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    Report report;
+    report.best = Move();
+    report.bestScore = 0;
+    report.playouts = finished_.load();
+    report.nodes = std::min(used_.load(), options_.nodeCapacity);
+    report.seconds = seconds;
+    report.playoutsPerSecond = seconds > 0 ? report.playouts / seconds : 0;
+
+    const Node &rootNode = nodes_[0];
+    if (rootNode.state.load() == EXPANDED) {
+        std::uint32_t bestVisits = 0;
+        for (std::uint32_t i = 0; i < rootNode.child_count.load(); ++i) {
+            const Node &child = nodes_[rootNode.first_child.load() + i];
+            std::uint32_t visits = child.visits.load();
+            if (visits > bestVisits) {
+                bestVisits = visits;
+                report.best = child.move;
+                report.bestScore = child.score.load() / (2.0 * visits);
+            }
+        }
+    }
+    return report;
+}
+
+void MctsEngine::resetNode(Node &node, const Move &move) {
+    node.visits.store(0, std::memory_order_relaxed);
+    node.score.store(0, std::memory_order_relaxed);
+    node.first_child.store(0, std::memory_order_relaxed);
+    node.child_count.store(0, std::memory_order_relaxed);
+    node.state.store(LEAF, std::memory_order_relaxed);
+    node.move = move;
+}
+
+void MctsEngine::worker(const Board &root, std::uint64_t seed) {
+    Random random(seed);
+    Clock::time_point start = Clock::now();
+    std::uint64_t done = 0;
+
+    while (started_.fetch_add(1, std::memory_order_relaxed) < options_.playouts) {
+        if (options_.seconds > 0 && done % CLOCK_INTERVAL == 0
+            && std::chrono::duration<double>(Clock::now() - start).count() >= options_.seconds) {
+            break;
+        }
+        Board board = root;
+        runIteration(board, random);
+        ++done;
+    }
+    finished_.fetch_add(done, std::memory_order_relaxed);
+}
+
+void MctsEngine::runIteration(Board &board, Random &random) {
+    // Deep enough for any realistic tree; a path that would go deeper just stops selecting
+    const int MAX_DEPTH = 256;
+    Node *path[MAX_DEPTH];
+    int depth = 0;
+
+    Node *node = &nodes_[0];
+    node->visits.fetch_add(1, std::memory_order_relaxed);
+    path[depth++] = node;
+
+    // Selection: every node on the way down is charged a visit now and credited its result
+    // later, so until then it looks like a loss to the other threads (virtual loss)
+    while (depth < MAX_DEPTH - 1 && node->state.load(std::memory_order_acquire) == EXPANDED) {
+        node = selectChild(*node);
+        node->visits.fetch_add(1, std::memory_order_relaxed);
+        board.makeMove(node->move);
+        path[depth++] = node;
+    }
+
+    MoveList moves;
+    board.generateMoves(moves);
+    Board::Result result = board.result(moves);
+
+    int value;  // For the side to move on the board
+    if (result == Board::ONGOING) {
+        if (node->state.load(std::memory_order_relaxed) == LEAF && expand(*node, moves)) {
+            node = &nodes_[node->first_child.load(std::memory_order_relaxed)
+                           + random.below(node->child_count.load(std::memory_order_relaxed))];
+            node->visits.fetch_add(1, std::memory_order_relaxed);
+            board.makeMove(node->move);
+            path[depth++] = node;
+        }
+        value = rollout(board, random);
+    } else {
+        value = result == Board::DRAW ? DRAW : LOSS;
+    }
+
+    // Each node scores the result for the side that moved into it, which alternates going up
+    for (int i = depth - 1; i >= 0; --i) {
+        value = WIN - value;
+        path[i]->score.fetch_add(value, std::memory_order_relaxed);
+    }
+}
+
+MctsEngine::Node *MctsEngine::selectChild(Node &parent) const {
+    const std::uint32_t first = parent.first_child.load(std::memory_order_relaxed);
+    const std::uint32_t count = parent.child_count.load(std::memory_order_relaxed);
+    const double logVisits = std::log(std::max<double>(1, parent.visits.load(std::memory_order_relaxed)));
+
+    Node *best = &nodes_[first];
+    double bestValue = -1;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        Node &child = nodes_[first + i];
+        std::uint32_t visits = child.visits.load(std::memory_order_relaxed);
+        if (visits == 0) {
+            return &child;
+        }
+        double value = child.score.load(std::memory_order_relaxed) / (2.0 * visits)
+                       + options_.exploration * std::sqrt(logVisits / visits);
+        if (value > bestValue) {
+            bestValue = value;
+            best = &child;
+        }
+    }
+    return best;
+}
+
+bool MctsEngine::expand(Node &node, const MoveList &moves) {
+    // Only the thread that wins the compare-and-swap expands; the others just play out from here
+    std::uint8_t expected = LEAF;
+    if (!node.state.compare_exchange_strong(expected, EXPANDING, std::memory_order_acquire)) {
+        return false;
+    }
+
+    std::size_t first = used_.fetch_add(moves.size(), std::memory_order_relaxed);
+    if (first + moves.size() > options_.nodeCapacity) {
+        node.state.store(FULL, std::memory_order_release);
+        return false;
+    }
+    for (int i = 0; i < moves.size(); ++i) {
+        resetNode(nodes_[first + i], moves[i]);
+    }
+    node.first_child.store(static_cast<std::uint32_t>(first), std::memory_order_relaxed);
+    node.child_count.store(static_cast<std::uint32_t>(moves.size()), std::memory_order_relaxed);
+    node.state.store(EXPANDED, std::memory_order_release);
+    return true;
+}
+
+int MctsEngine::rollout(Board &board, Random &random) const {
+    const int start = board.sideToMove();
+    for (int ply = 0; ply < options_.rolloutPlies; ++ply) {
+        // A recognized ending is scored exactly, so there is no need to play it out
+        int score;
+        if (Endgame::evaluate(board, score)) {
+            if (score == 0) {
+                return DRAW;
+            }
+            return (score > 0) == (board.sideToMove() == start) ? WIN : LOSS;
+        }
+
+        MoveList moves;
+        board.generateMoves(moves);
+        Board::Result result = board.result(moves);
+        if (result == Board::DRAW) {
+            return DRAW;
+        }
+        if (result == Board::SIDE_TO_MOVE_LOST) {
+            return board.sideToMove() == start ? LOSS : WIN;
+        }
+        board.makeMove(moves[random.below(moves.size())]);
+    }
+    return DRAW;
+}
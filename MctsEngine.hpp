@@ -0,0 +1,95 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file MctsEngine.hpp
+ * @brief This file defines the MctsEngine class, a multi-threaded Monte Carlo tree search over Board positions.
+ *
+ * Every thread repeatedly walks the shared tree with UCT selection, expands one leaf, finishes
+ * the game with uniformly random moves (stopping early in an ending Endgame knows) and backs the
+ * result up the path. The tree lives in a preallocated node pool and is only ever touched with
+ * atomic operations: a thread claims a leaf for expansion with a compare-and-swap, and every node
+ * on a thread's path is charged a visit on the way down (a "virtual loss") so concurrent threads
+ * spread out over different lines instead of all descending into the same one.
+ */
+
+#ifndef CHESS_MCTS_ENGINE_HPP
+#define CHESS_MCTS_ENGINE_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include "Board.hpp"
+#include "HashMemory.hpp"
+#include "Random.hpp"
+
+class MctsEngine {
+public:
+    struct Options {
+        unsigned threads = 0;                   // 0 uses every hardware thread
+        std::uint64_t playouts = 100000;        // Total playouts over all threads
+        double seconds = 0;                     // Wall clock limit, 0 for none
+        double exploration = 1.4;               // The UCT exploration constant
+        int rolloutPlies = 200;                 // Playouts longer than this count as draws
+        std::size_t nodeCapacity = 1 << 20;     // Size of the node pool; leaves stop expanding when it is full
+        std::uint64_t seed = 0;                 // Thread t draws from Random(seed + t)
+    };
+
+    struct Report {
+        Move best;                  // The most visited root move (the null move if there is none)
+        double bestScore;           // Its average result for the side to move, 0 (loss) to 1 (win)
+        std::uint64_t playouts;
+        std::uint64_t nodes;
+        double seconds;
+        double playoutsPerSecond;
+    };
+
+private:
+    struct Node {
+        std::atomic<std::uint32_t> visits;      // Includes visits still in flight (virtual losses)
+        std::atomic<std::uint64_t> score;       // Half points (win 2, draw 1) for the side that moved into the node
+        std::atomic<std::uint32_t> first_child;
+        std::atomic<std::uint32_t> child_count;
+        std::atomic<std::uint8_t> state;        // One of the NodeState values
+        Move move;
+    };
+
+    enum NodeState : std::uint8_t {
+        LEAF = 0,
+        EXPANDING = 1,
+        EXPANDED = 2,
+        FULL = 3        // The pool ran out while expanding; the node stays a leaf
+    };
+
+    Options options_;
+    HashMemory memory_;                         // Backs the node pool
+    Node *nodes_;
+    std::atomic<std::size_t> used_;
+    std::atomic<std::uint64_t> started_;
+    std::atomic<std::uint64_t> finished_;
+
+public:
+    /**
+     * @brief Parameterized constructor. Allocates the node pool once; it is reused by every search.
+     * @param options The search parameters
+     */
+    explicit MctsEngine(const Options &options);
+
+    /**
+     * @brief Searches the given position until the playout or time budget runs out.
+     * @param root A const reference to the position to search
+     * @return The chosen move and the search statistics
+     */
+    Report search(const Board &root);
+
+private:
+    void resetNode(Node &node, const Move &move);
+    void worker(const Board &root, std::uint64_t seed);
+    void runIteration(Board &board, Random &random);
+    Node *selectChild(Node &parent) const;
+    bool expand(Node &node, const MoveList &moves);
+    int rollout(Board &board, Random &random) const;
+};
+
+
+#endif //CHESS_MCTS_ENGINE_HPP
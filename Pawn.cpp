@@ -82,3 +82,37 @@ bool Pawn::canPromote() const {
     // Determine if pawn is in the last row (7th row) for "movingUp" or the first row (0th row) for "movingDown"
     return (isMovingUp()  && getRow() == ChessPiece::BOARD_LENGTH -1) || (!isMovingUp() && getRow() == 0);
 }
+
+/**
+ * @brief Compares two pawns: the ChessPiece attributes and the double jump flag.
+ * @param other A const reference to the pawn to compare with
+ * @return True if everything matches. False otherwise.
+ */
+bool Pawn::operator==(const Pawn &other) const {
+    return double_jumpable_ == other.double_jumpable_ && ChessPiece::operator==(other);
+}
+
+bool Pawn::operator!=(const Pawn &other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Orders pawns as ChessPiece does, then by the double jump flag.
+ * @param other A const reference to the pawn to compare with
+ * @return True if this pawn comes first. False otherwise.
+ */
+bool Pawn::operator<(const Pawn &other) const {
+    if (ChessPiece::operator<(other)) {
+        return true;
+    }
+    return !other.ChessPiece::operator<(*this) && double_jumpable_ < other.double_jumpable_;
+}
+
+/**
+ * @brief Extends ChessPiece::hash() with the double jump flag, and with a tag so that a pawn and a
+ *        ChessPiece with the same attributes hash apart. std::hash<Pawn> calls it.
+ * @return The hash value
+ */
+std::size_t Pawn::hash() const {
+    return combine(ChessPiece::hash(), HASH_TAG | double_jumpable_);
+}
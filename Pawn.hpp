@@ -18,6 +18,8 @@
 
 class Pawn: public ChessPiece{
 private:
+    static const std::uint64_t HASH_TAG = 1ULL << 40;   // Above every ChessPiece field
+
     bool double_jumpable_;
 
 public:
@@ -75,8 +77,39 @@ public:
      * @return True if this pawn can be promoted. False otherwise.
      */
     bool canPromote() const;
+
+    /**
+     * @brief Compares two pawns: the ChessPiece attributes and the double jump flag.
+     * @param other A const reference to the pawn to compare with
+     * @return True if everything matches. False otherwise.
+     */
+    bool operator==(const Pawn &other) const;
+    bool operator!=(const Pawn &other) const;
+
+    /**
+     * @brief Orders pawns as ChessPiece does, then by the double jump flag.
+     * @param other A const reference to the pawn to compare with
+     * @return True if this pawn comes first. False otherwise.
+     */
+    bool operator<(const Pawn &other) const;
+
+    /**
+     * @brief Extends ChessPiece::hash() with the double jump flag, and with a tag so that a pawn and a
+     *        ChessPiece with the same attributes hash apart. std::hash<Pawn> calls it.
+     * @return The hash value
+     */
+    std::size_t hash() const;
 };
 
+namespace std {
+    template <>
+    struct hash<Pawn> {
+        std::size_t operator()(const Pawn &pawn) const {
+            return pawn.hash();
+        }
+    };
+}
+
 
 #endif //CHESS_PAWN_HPP
 
@@ -0,0 +1,186 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Perft.cpp
+ * @brief This file contains the implementation of the perft routines and the PerftTable class.
+ */
+
+#include <algorithm>
+#include <memory>
+#include "Perft.hpp"
+
+namespace {
+    std::size_t floorPowerOfTwo(std::size_t value) {
+        std::size_t result = 1;
+        while (result * 2 <= value) {
+            result *= 2;
+        }
+        return result;
+    }
+}
+
+/**
+ * @brief Constructor. Allocates a table of about the given size, rounded down to a power of two,
+ *        on huge pages spread over the NUMA nodes where the system allows it.
+ * @param megabytes The size of the table
+ */
+PerftTable::PerftTable(std::size_t megabytes) {
+    std::size_t count = floorPowerOfTwo(std::max<std::size_t>(megabytes * 1024 * 1024 / sizeof(Entry), BUCKET));
+    owned_ = HashMemory(count * sizeof(Entry));
+    entries_ = static_cast<Entry *>(owned_.data());
+    std::uninitialized_default_construct_n(entries_, count);
+    mask_ = count / BUCKET - 1;
+    clear();
+}
+
+/**
+ * @brief Constructor over storage owned by someone else (eg. a shared memory segment).
+ * @param entries A pointer to zero-initialized entries that outlive the table
+ * @param count The number of entries; it is rounded down to a power of two
+ */
+PerftTable::PerftTable(Entry *entries, std::size_t count)
+        : entries_(entries), mask_(floorPowerOfTwo(std::max<std::size_t>(count, BUCKET)) / BUCKET - 1) {
+}
+
+/**
+ * @brief Looks up a cached count.
+ * @param key The position key
+ * @param depth The remaining depth
+ * @param count A reference that receives the count on a hit
+ * @return True on a hit. False otherwise.
+ */
+bool PerftTable::probe(std::uint64_t key, int depth, std::uint64_t &count) const {
+    const Entry *slots = bucket(key);
+    for (int i = 0; i < BUCKET; ++i) {
+        std::uint64_t data = slots[i].data.load(std::memory_order_relaxed);
+        std::uint64_t check = slots[i].check.load(std::memory_order_relaxed);
+        if ((check ^ data) == key && static_cast<int>(data & 0xFF) == depth && data != 0) {
+            count = data >> 8;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Stores a count.
+ * @param key The position key
+ * @param depth The remaining depth
+ * @param count The number of leaves below the position at that depth
+ */
+void PerftTable::store(std::uint64_t key, int depth, std::uint64_t count) {
+    Entry *slots = entries_ + (key & mask_) * BUCKET;
+    std::uint64_t data = (count << 8) | static_cast<std::uint64_t>(depth & 0xFF);
+
+    // Deeper results save more work, so they win slot 0; everything else lands in slot 1
+    int slot = 1;
+    std::uint64_t held = slots[0].data.load(std::memory_order_relaxed);
+    if (static_cast<int>(held & 0xFF) <= depth) {
+        slot = 0;
+    }
+    slots[slot].data.store(data, std::memory_order_relaxed);
+    slots[slot].check.store(key ^ data, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Empties the table.
+ */
+void PerftTable::clear() {
+    for (std::size_t i = 0; i < size(); ++i) {
+        entries_[i].check.store(0, std::memory_order_relaxed);
+        entries_[i].data.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::size_t PerftTable::size() const {
+    return (mask_ + 1) * BUCKET;
+}
+
+const PerftTable::Entry *PerftTable::bucket(std::uint64_t key) const {
+    return entries_ + (key & mask_) * BUCKET;
+}
+
+
+/**
+ * @brief Counts the leaves of the move tree, counting the last ply by move list size.
+ * @param board A reference to the position; it is restored before returning
+ * @param depth The depth to count to
+ * @return The number of leaves
+ */
+std::uint64_t Perft::count(Board &board, int depth) {
+    if (depth <= 0) {
+        return 1;
+    }
+    MoveList moves;
+    board.generateMoves(moves);
+    if (depth == 1) {
+        return moves.size();
+    }
+
+    std::uint64_t leaves = 0;
+    for (int i = 0; i < moves.size(); ++i) {
+        Board::Undo undo = board.makeMove(moves[i]);
+        leaves += count(board, depth - 1);
+        board.unmakeMove(moves[i], undo);
+    }
+    return leaves;
+}
+
+/**
+ * @brief Same as count(board, depth), reusing and filling the table's cached subtree counts.
+ */
+std::uint64_t Perft::count(Board &board, int depth, PerftTable &table) {
+    if (depth <= 0) {
+        return 1;
+    }
+    // Depth 1 is cheaper to regenerate than to look up
+    if (depth == 1) {
+        MoveList moves;
+        board.generateMoves(moves);
+        return moves.size();
+    }
+
+    std::uint64_t leaves;
+    if (table.probe(board.key(), depth, leaves)) {
+        return leaves;
+    }
+
+    MoveList moves;
+    board.generateMoves(moves);
+
+    // Children at depth 2 or more probe the table first thing, so their buckets are requested
+    // together up front and the misses overlap instead of being paid one child at a time
+    if (depth > 2) {
+        for (int i = 0; i < moves.size(); ++i) {
+            table.prefetch(board.keyAfter(moves[i]));
+        }
+    }
+    leaves = 0;
+    for (int i = 0; i < moves.size(); ++i) {
+        Board::Undo undo = board.makeMove(moves[i]);
+        leaves += count(board, depth - 1, table);
+        board.unmakeMove(moves[i], undo);
+    }
+    table.store(board.key(), depth, leaves);
+    return leaves;
+}
+
+/**
+ * @brief Counts the leaves below each root move separately ("divide").
+ * @param board A reference to the position; it is restored before returning
+ * @param depth The depth to count to, at least 1
+ * @param table A pointer to a table to use, or nullptr for none
+ * @return One (move, leaves) pair per root move
+ */
+std::vector<std::pair<Move, std::uint64_t>> Perft::divide(Board &board, int depth, PerftTable *table) {
+    std::vector<std::pair<Move, std::uint64_t>> result;
+    MoveList moves;
+    board.generateMoves(moves);
+    for (int i = 0; i < moves.size(); ++i) {
+        Board::Undo undo = board.makeMove(moves[i]);
+        std::uint64_t leaves = table ? count(board, depth - 1, *table) : count(board, depth - 1);
+        board.unmakeMove(moves[i], undo);
+        result.emplace_back(moves[i], leaves);
+    }
+    return result;
+}
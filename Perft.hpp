@@ -0,0 +1,136 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Perft.hpp
+ * @brief This file declares the perft (move path enumeration) routines and the PerftTable
+ *        they cache subtree counts in.
+ *
+ * Perft counts the leaves of the move tree to a fixed depth and is the standard check that
+ * move generation and make / unmake agree. Two things make it fast here:
+ *   - Bulk counting: the last ply is counted by the size of the move list, so leaf moves are
+ *     never made.
+ *   - Caching: the count of every (position key, depth) pair is stored in a PerftTable, so a
+ *     subtree reached again through a different move order is not walked a second time.
+ */
+
+#ifndef CHESS_PERFT_HPP
+#define CHESS_PERFT_HPP
+
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Board.hpp"
+#include "HashMemory.hpp"
+
+class PerftTable {
+public:
+    /**
+     * @brief One slot of the table. The key is stored XORed with the data, so an entry torn by
+     *        two concurrent writers simply fails to verify instead of returning a wrong count.
+     */
+    struct Entry {
+        std::atomic<std::uint64_t> check;   // key ^ data
+        std::atomic<std::uint64_t> data;    // count << 8 | depth
+    };
+
+private:
+    static const int BUCKET = 2;    // Slot 0 keeps the deepest result, slot 1 the latest
+
+    HashMemory owned_;              // Empty when the entries belong to someone else
+    Entry *entries_;
+    std::size_t mask_;              // Bucket count - 1
+
+public:
+    /**
+     * @brief Constructor. Allocates a table of about the given size, rounded down to a power of two,
+     *        on huge pages spread over the NUMA nodes where the system allows it.
+     * @param megabytes The size of the table
+     */
+    explicit PerftTable(std::size_t megabytes);
+
+    /**
+     * @brief Constructor over storage owned by someone else (eg. a shared memory segment).
+     * @param entries A pointer to zero-initialized entries that outlive the table
+     * @param count The number of entries; it is rounded down to a power of two
+     */
+    PerftTable(Entry *entries, std::size_t count);
+
+    PerftTable(const PerftTable &) = delete;
+    PerftTable &operator=(const PerftTable &) = delete;
+
+    /**
+     * @brief Looks up a cached count.
+     * @param key The position key
+     * @param depth The remaining depth
+     * @param count A reference that receives the count on a hit
+     * @return True on a hit. False otherwise.
+     */
+    bool probe(std::uint64_t key, int depth, std::uint64_t &count) const;
+
+    /**
+     * @brief Stores a count.
+     * @param key The position key
+     * @param depth The remaining depth
+     * @param count The number of leaves below the position at that depth
+     */
+    void store(std::uint64_t key, int depth, std::uint64_t count);
+
+    /**
+     * @brief Empties the table.
+     */
+    void clear();
+
+    /**
+     * @return The number of entries in the table
+     */
+    std::size_t size() const;
+
+    /**
+     * @param key A position key
+     * @return The address of the bucket the key maps to
+     */
+    const Entry *bucket(std::uint64_t key) const;
+
+    /**
+     * @brief Starts loading the bucket of a key into the cache, so a later probe() does not stall.
+     * @param key A position key
+     */
+    void prefetch(std::uint64_t key) const {
+#if defined(__GNUC__)
+        __builtin_prefetch(entries_ + (key & mask_) * BUCKET);
+#else
+        (void) key;
+#endif
+    }
+};
+
+namespace Perft {
+
+    /**
+     * @brief Counts the leaves of the move tree, counting the last ply by move list size.
+     * @param board A reference to the position; it is restored before returning
+     * @param depth The depth to count to
+     * @return The number of leaves
+     */
+    std::uint64_t count(Board &board, int depth);
+
+    /**
+     * @brief Same as count(board, depth), reusing and filling the table's cached subtree counts.
+     */
+    std::uint64_t count(Board &board, int depth, PerftTable &table);
+
+    /**
+     * @brief Counts the leaves below each root move separately ("divide").
+     * @param board A reference to the position; it is restored before returning
+     * @param depth The depth to count to, at least 1
+     * @param table A pointer to a table to use, or nullptr for none
+     * @return One (move, leaves) pair per root move
+     */
+    std::vector<std::pair<Move, std::uint64_t>> divide(Board &board, int depth, PerftTable *table = nullptr);
+}
+
+
+#endif //CHESS_PERFT_HPP
@@ -0,0 +1,383 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PieceIndex.cpp
+ * @brief This file contains the implementation of the PositionSet, Bitmap and PieceIndex classes.
+ *
+ * All bitmap operations work on whole 64 bit words in simple loops, which the compiler
+ * turns into vector instructions.
+ */
+
+#include <algorithm>
+#include "BitUtil.hpp"
+#include "PieceIndex.hpp"
+
+/**
+ * @brief Starts a new, empty position. Pieces added afterwards belong to it.
+ * @return The 0-indexed id of the new position
+ */
+std::size_t PositionSet::beginPosition() {
+    starts_.push_back(pieces_.size());
+    return starts_.size() - 1;
+}
+
+/**
+ * @brief Adds a piece to the most recent position, starting one if none exists yet.
+ */
+void PositionSet::add(const PieceRecord &piece) {
+    if (starts_.empty()) {
+        beginPosition();
+    }
+    pieces_.push_back(piece);
+}
+
+void PositionSet::add(const ChessPiece &piece) {
+    add(PieceRecord::fromPiece(piece));
+}
+
+void PositionSet::add(const Pawn &pawn) {
+    add(PieceRecord::fromPawn(pawn));
+}
+
+void PositionSet::add(const Rook &rook) {
+    add(PieceRecord::fromRook(rook));
+}
+
+std::size_t PositionSet::positionCount() const {
+    return starts_.size();
+}
+
+std::size_t PositionSet::size() const {
+    return pieces_.size();
+}
+
+std::size_t PositionSet::begin(std::size_t position) const {
+    return starts_[position];
+}
+
+std::size_t PositionSet::end(std::size_t position) const {
+    return position + 1 < starts_.size() ? starts_[position + 1] : pieces_.size();
+}
+
+const std::vector<PieceRecord> &PositionSet::pieces() const {
+    return pieces_;
+}
+
+
+/**
+ * @brief Constructor. Creates a bitmap of the given number of bits, all cleared.
+ * @param size The number of bits
+ */
+Bitmap::Bitmap(std::size_t size) : words_((size + 63) / 64, 0), size_(size) {
+}
+
+std::size_t Bitmap::size() const {
+    return size_;
+}
+
+bool Bitmap::test(std::size_t index) const {
+    return (words_[index / 64] >> (index % 64)) & 1;
+}
+
+void Bitmap::set(std::size_t index) {
+    words_[index / 64] |= std::uint64_t(1) << (index % 64);
+}
+
+std::size_t Bitmap::count() const {
+    std::size_t total = 0;
+    for (std::uint64_t word : words_) {
+        total += BitUtil::popcount(word);
+    }
+    return total;
+}
+
+bool Bitmap::any() const {
+    for (std::uint64_t word : words_) {
+        if (word) {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<std::size_t> Bitmap::indices() const {
+    std::vector<std::size_t> result;
+    result.reserve(count());
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        std::uint64_t word = words_[w];
+        while (word) {
+            result.push_back(w * 64 + BitUtil::popLsb(word));
+        }
+    }
+    return result;
+}
+
+Bitmap &Bitmap::operator&=(const Bitmap &other) {
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        words_[w] &= other.words_[w];
+    }
+    return *this;
+}
+
+Bitmap &Bitmap::operator|=(const Bitmap &other) {
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        words_[w] |= other.words_[w];
+    }
+    return *this;
+}
+
+Bitmap &Bitmap::andNot(const Bitmap &other) {
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        words_[w] &= ~other.words_[w];
+    }
+    return *this;
+}
+
+Bitmap Bitmap::operator~() const {
+    Bitmap result(*this);
+    for (std::uint64_t &word : result.words_) {
+        word = ~word;
+    }
+    result.clearTail();
+    return result;
+}
+
+const std::vector<std::uint64_t> &Bitmap::words() const {
+    return words_;
+}
+
+void Bitmap::clearTail() {
+    // Keep the bits past size_ clear so count() and indices() never see them
+    if (size_ % 64 != 0) {
+        words_.back() &= (std::uint64_t(1) << (size_ % 64)) - 1;
+    }
+}
+
+Bitmap operator&(Bitmap left, const Bitmap &right) {
+    return left &= right;
+}
+
+Bitmap operator|(Bitmap left, const Bitmap &right) {
+    return left |= right;
+}
+
+
+/**
+ * @brief Builds all column bitmaps over the given positions.
+ * @param positions The positions to index. They must outlive the index and must not
+ *        be modified while it is in use.
+ */
+PieceIndex::PieceIndex(const PositionSet &positions)
+        : positions_(positions), size_(positions.size()), position_of_(positions.size()),
+          pawn_(size_), rook_(size_), moving_up_(size_), on_board_(size_),
+          rows_(ChessPiece::BOARD_LENGTH, Bitmap(size_)),
+          columns_(ChessPiece::BOARD_LENGTH, Bitmap(size_)) {
+    const std::vector<PieceRecord> &pieces = positions.pieces();
+
+    for (std::size_t p = 0; p < positions.positionCount(); ++p) {
+        for (std::size_t i = positions.begin(p); i < positions.end(p); ++i) {
+            position_of_[i] = static_cast<std::uint32_t>(p);
+        }
+    }
+
+    // The castle move counts are stored bit-sliced: slice b holds bit b of every rook's count
+    std::int32_t maxCastle = 0;
+    for (const PieceRecord &piece : pieces) {
+        if (piece.kind == PieceKind::ROOK) {
+            maxCastle = std::max(maxCastle, piece.castleMovesLeft);
+        }
+    }
+    int sliceCount = 0;
+    while (sliceCount < 31 && (std::int64_t(1) << sliceCount) <= maxCastle) {
+        ++sliceCount;
+    }
+    castle_slices_.assign(sliceCount, Bitmap(size_));
+
+    for (std::size_t i = 0; i < size_; ++i) {
+        const PieceRecord &piece = pieces[i];
+        if (piece.color >= colors_.size()) {
+            colors_.resize(piece.color + 1, Bitmap(size_));
+        }
+        colors_[piece.color].set(i);
+        if (piece.movingUp) {
+            moving_up_.set(i);
+        }
+        if (piece.isOnBoard()) {
+            on_board_.set(i);
+            rows_[piece.row].set(i);
+            columns_[piece.column].set(i);
+        }
+        if (piece.kind == PieceKind::PAWN) {
+            pawn_.set(i);
+        } else if (piece.kind == PieceKind::ROOK) {
+            rook_.set(i);
+            for (int b = 0; b < sliceCount; ++b) {
+                if (piece.castleMovesLeft > 0 && ((piece.castleMovesLeft >> b) & 1)) {
+                    castle_slices_[b].set(i);
+                }
+            }
+        }
+    }
+}
+
+std::size_t PieceIndex::size() const {
+    return size_;
+}
+
+/**
+ * @brief Selects all pieces matching every column constraint of the filter.
+ * @param filter A const reference to the filter to evaluate
+ * @return A bitmap with one bit set per matching piece
+ */
+Bitmap PieceIndex::select(const Filter &filter) const {
+    Bitmap result = ~Bitmap(size_);
+
+    if (filter.kind == static_cast<int>(PieceKind::PAWN)) {
+        result &= pawn_;
+    } else if (filter.kind == static_cast<int>(PieceKind::ROOK)) {
+        result &= rook_;
+    } else if (filter.kind == static_cast<int>(PieceKind::PIECE)) {
+        result.andNot(pawn_ | rook_);
+    }
+
+    if (filter.color >= 0) {
+        if (static_cast<std::size_t>(filter.color) >= colors_.size()) {
+            return Bitmap(size_);
+        }
+        result &= colors_[filter.color];
+    }
+
+    // Out of range rows and columns never match, just like an off-board piece never matches
+    if (filter.row >= 0) {
+        if (filter.row >= ChessPiece::BOARD_LENGTH) {
+            return Bitmap(size_);
+        }
+        result &= rows_[filter.row];
+    }
+    if (filter.column >= 0) {
+        if (filter.column >= ChessPiece::BOARD_LENGTH) {
+            return Bitmap(size_);
+        }
+        result &= columns_[filter.column];
+    }
+
+    if (filter.movingUp == 1) {
+        result &= moving_up_;
+    } else if (filter.movingUp == 0) {
+        result.andNot(moving_up_);
+    }
+
+    if (filter.minCastleMoves >= 0) {
+        result &= castleMovesAtLeast(filter.minCastleMoves);
+    }
+    return result;
+}
+
+/**
+ * @brief Selects the rooks whose castle move count is at least the given value,
+ *        using the bit-sliced castle index.
+ * @param moves The minimum number of castle moves
+ * @return A bitmap of the matching rooks
+ */
+Bitmap PieceIndex::castleMovesAtLeast(std::int64_t moves) const {
+    if (moves <= 0) {
+        return rook_;
+    }
+    if (moves >= (std::int64_t(1) << castle_slices_.size())) {
+        return Bitmap(size_);
+    }
+
+    // Walk the slices from the most significant bit down, tracking which rooks are already
+    // strictly greater than the constant and which are still equal to its prefix
+    Bitmap greater(size_);
+    Bitmap equal = rook_;
+    for (std::size_t b = castle_slices_.size(); b-- > 0;) {
+        if ((moves >> b) & 1) {
+            equal &= castle_slices_[b];
+        } else {
+            greater |= equal & castle_slices_[b];
+            equal.andNot(castle_slices_[b]);
+        }
+    }
+    return greater |= equal;
+}
+
+/**
+ * @brief Selects every pawn for which Pawn::canPromote would return true.
+ * @return A bitmap of the matching pawns
+ */
+Bitmap PieceIndex::promotablePawns() const {
+    Bitmap upward = moving_up_ & rows_[ChessPiece::BOARD_LENGTH - 1];
+    Bitmap downward = rows_[0];
+    downward.andNot(moving_up_);
+    return pawn_ & (upward |= downward);
+}
+
+/**
+ * @brief Selects every rook for which Rook::canCastle would return true with at least
+ *        one OTHER piece stored in the same position.
+ * @return A bitmap of the matching rooks
+ */
+Bitmap PieceIndex::castlingRooks() const {
+    // Push the single-column predicates down first: only on-board rooks with a castle move
+    // left can ever castle, and usually that removes almost every piece
+    Bitmap candidates = castleMovesAtLeast(1) & on_board_;
+    Bitmap result(size_);
+    const std::vector<PieceRecord> &pieces = positions_.pieces();
+
+    for (std::size_t rook : candidates.indices()) {
+        const PieceRecord &piece = pieces[rook];
+        std::size_t position = position_of_[rook];
+        std::size_t first = positions_.begin(position);
+        std::size_t last = positions_.end(position);
+
+        const std::vector<std::uint64_t> &color = colors_[piece.color].words();
+        const std::vector<std::uint64_t> &row = rows_[piece.row].words();
+        const std::vector<std::uint64_t> &center = columns_[piece.column].words();
+        const std::vector<std::uint64_t> *left = piece.column > 0 ? &columns_[piece.column - 1].words() : nullptr;
+        const std::vector<std::uint64_t> *right = piece.column + 1 < ChessPiece::BOARD_LENGTH
+                                                  ? &columns_[piece.column + 1].words() : nullptr;
+
+        // Only the words covering this position are touched; the edge words are masked
+        for (std::size_t w = first / 64; w <= (last - 1) / 64; ++w) {
+            std::uint64_t adjacent = center[w];
+            if (left) {
+                adjacent |= (*left)[w];
+            }
+            if (right) {
+                adjacent |= (*right)[w];
+            }
+            std::uint64_t partners = color[w] & row[w] & adjacent;
+            if (w == first / 64) {
+                partners &= ~std::uint64_t(0) << (first % 64);
+            }
+            if (w == (last - 1) / 64 && last % 64 != 0) {
+                partners &= (std::uint64_t(1) << (last % 64)) - 1;
+            }
+            if (w == rook / 64) {
+                partners &= ~(std::uint64_t(1) << (rook % 64));
+            }
+            if (partners) {
+                result.set(rook);
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Maps a piece bitmap to the positions that contain at least one of its pieces.
+ * @param pieces A const reference to a bitmap returned by this index
+ * @return The matching position ids, in increasing order
+ */
+std::vector<std::size_t> PieceIndex::positionsWith(const Bitmap &pieces) const {
+    std::vector<std::size_t> result;
+    for (std::size_t i : pieces.indices()) {
+        std::size_t position = position_of_[i];
+        if (result.empty() || result.back() != position) {
+            result.push_back(position);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,217 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PieceIndex.hpp
+ * @brief This file defines the PositionSet, Bitmap and PieceIndex classes used to query large
+ *        collections of stored positions without materializing Pawn or Rook objects.
+ *
+ * A PositionSet stores many positions back to back as PieceRecords. A PieceIndex is built once
+ * over a PositionSet and keeps one bitmap per value of each column (kind, color, row, column,
+ * direction) plus a bit-sliced index over the castle move counts. Predicates such as
+ * Pawn::canPromote and Rook::canCastle are then answered with word-wide AND / OR operations,
+ * and the cheap column filters are applied first so the pairwise castle check only runs on
+ * the few rooks that survive them.
+ */
+
+#ifndef CHESS_PIECE_INDEX_HPP
+#define CHESS_PIECE_INDEX_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PieceRecord.hpp"
+
+class PositionSet {
+private:
+    std::vector<PieceRecord> pieces_;
+    std::vector<std::size_t> starts_;
+
+public:
+    /**
+     * @brief Starts a new, empty position. Pieces added afterwards belong to it.
+     * @return The 0-indexed id of the new position
+     */
+    std::size_t beginPosition();
+
+    /**
+     * @brief Adds a piece to the most recent position, starting one if none exists yet.
+     * @param piece The piece to store. Overloads exist for generic pieces, pawns and rooks
+     *        so the stored record keeps the subclass flags.
+     */
+    void add(const PieceRecord &piece);
+    void add(const ChessPiece &piece);
+    void add(const Pawn &pawn);
+    void add(const Rook &rook);
+
+    /**
+     * @return The number of positions stored
+     */
+    std::size_t positionCount() const;
+
+    /**
+     * @return The number of pieces stored across all positions
+     */
+    std::size_t size() const;
+
+    /**
+     * @param position A 0-indexed position id
+     * @return The index of the first piece of the position
+     */
+    std::size_t begin(std::size_t position) const;
+
+    /**
+     * @param position A 0-indexed position id
+     * @return One past the index of the last piece of the position
+     */
+    std::size_t end(std::size_t position) const;
+
+    /**
+     * @return All stored pieces, position after position
+     */
+    const std::vector<PieceRecord> &pieces() const;
+};
+
+class Bitmap {
+private:
+    std::vector<std::uint64_t> words_;
+    std::size_t size_;
+
+public:
+    /**
+     * @brief Constructor. Creates a bitmap of the given number of bits, all cleared.
+     * @param size The number of bits
+     */
+    explicit Bitmap(std::size_t size = 0);
+
+    /**
+     * @return The number of bits in the bitmap
+     */
+    std::size_t size() const;
+
+    /**
+     * @param index A 0-indexed bit position in [0, size())
+     * @return True if the bit is set. False otherwise.
+     */
+    bool test(std::size_t index) const;
+
+    /**
+     * @brief Sets a single bit.
+     * @param index A 0-indexed bit position in [0, size())
+     */
+    void set(std::size_t index);
+
+    /**
+     * @return The number of set bits
+     */
+    std::size_t count() const;
+
+    /**
+     * @return True if at least one bit is set. False otherwise.
+     */
+    bool any() const;
+
+    /**
+     * @return The positions of the set bits, in increasing order
+     */
+    std::vector<std::size_t> indices() const;
+
+    /**
+     * @brief Word-wide boolean operations. Both bitmaps must have the same size.
+     */
+    Bitmap &operator&=(const Bitmap &other);
+    Bitmap &operator|=(const Bitmap &other);
+    Bitmap &andNot(const Bitmap &other);
+    Bitmap operator~() const;
+
+    /**
+     * @return The raw 64 bit words backing the bitmap. Bits past size() are always clear.
+     */
+    const std::vector<std::uint64_t> &words() const;
+
+private:
+    void clearTail();
+};
+
+Bitmap operator&(Bitmap left, const Bitmap &right);
+Bitmap operator|(Bitmap left, const Bitmap &right);
+
+class PieceIndex {
+public:
+    /**
+     * @brief Describes a conjunctive filter over the indexed columns.
+     *        Every member left at its "any" value (-1) does not take part in the filter.
+     */
+    struct Filter {
+        int kind = -1;              // A PieceKind value
+        int color = -1;             // A color id from PieceRecord::colorId
+        int row = -1;
+        int column = -1;
+        int movingUp = -1;          // 0 or 1
+        std::int64_t minCastleMoves = -1;
+    };
+
+private:
+    const PositionSet &positions_;
+    std::size_t size_;
+    std::vector<std::uint32_t> position_of_;
+    Bitmap pawn_;
+    Bitmap rook_;
+    Bitmap moving_up_;
+    Bitmap on_board_;
+    std::vector<Bitmap> colors_;
+    std::vector<Bitmap> rows_;
+    std::vector<Bitmap> columns_;
+    std::vector<Bitmap> castle_slices_;     // Bit i of every rook's castle move count
+
+public:
+    /**
+     * @brief Builds all column bitmaps over the given positions.
+     * @param positions The positions to index. They must outlive the index and must not
+     *        be modified while it is in use.
+     */
+    explicit PieceIndex(const PositionSet &positions);
+
+    /**
+     * @return The number of indexed pieces (ie. the size of every returned bitmap)
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Selects all pieces matching every column constraint of the filter.
+     * @param filter A const reference to the filter to evaluate
+     * @return A bitmap with one bit set per matching piece
+     */
+    Bitmap select(const Filter &filter) const;
+
+    /**
+     * @brief Selects the rooks whose castle move count is at least the given value,
+     *        using the bit-sliced castle index.
+     * @param moves The minimum number of castle moves
+     * @return A bitmap of the matching rooks
+     */
+    Bitmap castleMovesAtLeast(std::int64_t moves) const;
+
+    /**
+     * @brief Selects every pawn for which Pawn::canPromote would return true.
+     * @return A bitmap of the matching pawns
+     */
+    Bitmap promotablePawns() const;
+
+    /**
+     * @brief Selects every rook for which Rook::canCastle would return true with at least
+     *        one OTHER piece stored in the same position.
+     * @return A bitmap of the matching rooks
+     */
+    Bitmap castlingRooks() const;
+
+    /**
+     * @brief Maps a piece bitmap to the positions that contain at least one of its pieces.
+     * @param pieces A const reference to a bitmap returned by this index
+     * @return The matching position ids, in increasing order
+     */
+    std::vector<std::size_t> positionsWith(const Bitmap &pieces) const;
+};
+
+
+#endif //CHESS_PIECE_INDEX_HPP
@@ -0,0 +1,112 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PieceOrder.cpp
+ * @brief This file contains the implementation of the bulk reordering of piece arrays.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include "PieceOrder.hpp"
+
+namespace {
+    const int SQUARES = ChessPiece::BOARD_LENGTH * ChessPiece::BOARD_LENGTH;
+    const int DIGIT_BITS = 12;      // 4096 buckets: the counts stay in L1
+
+    // One stable counting sort pass of the indices on bits [shift, shift + bits) of their keys
+    void sortPass(const std::vector<std::uint32_t> &keys, const std::vector<std::size_t> &from,
+                  std::vector<std::size_t> &to, int shift, int bits) {
+        const std::uint32_t mask = (std::uint32_t(1) << bits) - 1;
+        std::vector<std::size_t> counts((std::size_t(1) << bits) + 1, 0);
+        for (std::size_t i : from) {
+            ++counts[((keys[i] >> shift) & mask) + 1];
+        }
+        for (std::size_t digit = 1; digit < counts.size(); ++digit) {
+            counts[digit] += counts[digit - 1];
+        }
+        to.resize(from.size());
+        for (std::size_t i : from) {
+            to[counts[(keys[i] >> shift) & mask]++] = i;
+        }
+    }
+}
+
+/**
+ * @brief Computes the board order of the pieces without moving them.
+ * @param pieces A pointer to the first record
+ * @param count The number of records
+ * @param indices A reference to a vector that receives the index of every piece in sorted
+ *        order (it is overwritten)
+ * @return The number of pieces on the board, ie. the length of the sorted prefix of indices
+ *         before the off-board pieces
+ */
+std::size_t PieceOrder::order(const PieceRecord *pieces, std::size_t count, std::vector<std::size_t> &indices) {
+    // Key: color * SQUARES + square, and one past the largest on-board key for the rest
+    std::vector<std::uint32_t> keys(count);
+    std::uint32_t offBoard = 0;
+    std::size_t onBoard = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (pieces[i].isOnBoard()) {
+            keys[i] = static_cast<std::uint32_t>(pieces[i].color) * SQUARES
+                      + static_cast<std::uint32_t>(pieces[i].row * ChessPiece::BOARD_LENGTH + pieces[i].column);
+            offBoard = std::max(offBoard, keys[i] + 1);
+            ++onBoard;
+        }
+    }
+    int bits = 1;
+    while ((offBoard >> bits) != 0) {
+        ++bits;
+    }
+
+    std::vector<std::size_t> input(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        input[i] = i;
+        if (!pieces[i].isOnBoard()) {
+            keys[i] = offBoard;
+        }
+    }
+    if (bits <= DIGIT_BITS) {
+        sortPass(keys, input, indices, 0, bits);
+    } else {
+        const int low = bits / 2;
+        sortPass(keys, input, indices, 0, low);
+        sortPass(keys, indices, input, low, bits - low);
+        indices.swap(input);
+    }
+    return onBoard;
+}
+
+/**
+ * @brief Reorders the pieces into board order.
+ * @param pieces A reference to the pieces to reorder
+ * @param permutation A pointer to a vector that receives, for each position of the sorted
+ *        pieces, the index the piece had before, or nullptr if it is not needed
+ * @return The number of pieces on the board, which now come first
+ */
+std::size_t PieceOrder::sortBySquare(std::vector<PieceRecord> &pieces, std::vector<std::size_t> *permutation) {
+    if (permutation != nullptr) {
+        permutation->resize(pieces.size());
+    }
+    return sortBySquare(pieces.data(), pieces.size(), permutation != nullptr ? permutation->data() : nullptr);
+}
+
+/**
+ * @brief Same as sortBySquare(pieces, permutation), over a plain array of records.
+ * @param pieces A pointer to the first record
+ * @param count The number of records
+ * @param permutation A pointer to count indices that receive the permutation, or nullptr
+ */
+std::size_t PieceOrder::sortBySquare(PieceRecord *pieces, std::size_t count, std::size_t *permutation) {
+    std::vector<std::size_t> indices;
+    const std::size_t onBoard = order(pieces, count, indices);
+    std::vector<PieceRecord> sorted;
+    sorted.reserve(count);
+    for (std::size_t i : indices) {
+        sorted.push_back(pieces[i]);
+    }
+    std::copy(sorted.begin(), sorted.end(), pieces);
+    if (permutation != nullptr) {
+        std::copy(indices.begin(), indices.end(), permutation);
+    }
+    return onBoard;
+}
@@ -0,0 +1,54 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PieceOrder.hpp
+ * @brief This file declares the bulk reordering of piece arrays into board order.
+ *
+ * Pieces are ordered by (color id, row, column): each piece gets an integer key and the keys are
+ * sorted with an LSD radix sort, in one pass when the key fits 12 bits (up to 64 colors) and in
+ * two otherwise, so the cost is linear in the number of pieces. The sort is stable. Pieces that
+ * are not on the board go after all the others, in their input order. Colors are ordered by
+ * interned id (WHITE, BLACK, then the others by first use), not by name as ChessPiece::operator<.
+ */
+
+#ifndef CHESS_PIECE_ORDER_HPP
+#define CHESS_PIECE_ORDER_HPP
+
+
+#include <cstddef>
+#include <vector>
+#include "PieceRecord.hpp"
+
+namespace PieceOrder {
+
+    /**
+     * @brief Computes the board order of the pieces without moving them.
+     * @param pieces A pointer to the first record
+     * @param count The number of records
+     * @param indices A reference to a vector that receives the index of every piece in sorted
+     *        order (it is overwritten)
+     * @return The number of pieces on the board, ie. the length of the sorted prefix of indices
+     *         before the off-board pieces
+     */
+    std::size_t order(const PieceRecord *pieces, std::size_t count, std::vector<std::size_t> &indices);
+
+    /**
+     * @brief Reorders the pieces into board order.
+     * @param pieces A reference to the pieces to reorder
+     * @param permutation A pointer to a vector that receives, for each position of the sorted
+     *        pieces, the index the piece had before, or nullptr if it is not needed
+     * @return The number of pieces on the board, which now come first
+     */
+    std::size_t sortBySquare(std::vector<PieceRecord> &pieces, std::vector<std::size_t> *permutation = nullptr);
+
+    /**
+     * @brief Same as sortBySquare(pieces, permutation), over a plain array of records.
+     * @param pieces A pointer to the first record
+     * @param count The number of records
+     * @param permutation A pointer to count indices that receive the permutation, or nullptr
+     */
+    std::size_t sortBySquare(PieceRecord *pieces, std::size_t count, std::size_t *permutation = nullptr);
+}
+
+
+#endif //CHESS_PIECE_ORDER_HPP
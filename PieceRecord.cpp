@@ -0,0 +1,215 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PieceRecord.cpp
+ * @brief This file contains the implementation of the PieceRecord struct.
+ *
+ * Conversions to and from the piece classes live here, together with the process-wide
+ * color table used to intern color names into small ids.
+ */
+
+#include <cstdlib>
+#include <mutex>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+#include "PieceRecord.hpp"
+
+namespace {
+    // The color table is shared by every record in the process and guarded by a mutex,
+    // since colors are interned from whichever thread happens to convert a piece first.
+    struct ColorTable {
+        std::mutex lock;
+        std::vector<std::string> names{"WHITE", "BLACK"};
+        std::unordered_map<std::string, std::uint16_t> ids{{"WHITE", 0}, {"BLACK", 1}};
+    };
+
+    ColorTable &colorTable() {
+        static ColorTable table;
+        return table;
+    }
+
+    PieceRecord fromBase(const ChessPiece &piece, PieceKind kind) {
+        PieceRecord record;
+        record.kind = kind;
+        record.row = static_cast<std::int8_t>(piece.getRow());
+        record.column = static_cast<std::int8_t>(piece.getColumn());
+        record.movingUp = piece.isMovingUp();
+        record.color = PieceRecord::colorId(piece.getColor());
+        return record;
+    }
+}
+
+/**
+ * @brief Default Constructor. Mirrors the default ChessPiece: a BLACK generic piece
+ *        that is not on the board and is not moving up.
+ */
+PieceRecord::PieceRecord()
+        : kind(PieceKind::PIECE), row(-1), column(-1), movingUp(false), doubleJumpable(false),
+          color(BLACK), castleMovesLeft(0) {
+}
+
+/**
+ * @brief Builds a record from a generic chess piece.
+ * @param piece A const reference to the piece to copy
+ * @return A record of kind PIECE holding the piece's color, square and direction
+ */
+PieceRecord PieceRecord::fromPiece(const ChessPiece &piece) {
+    return fromBase(piece, PieceKind::PIECE);
+}
+
+/**
+ * @brief Builds a record from a pawn.
+ * @param pawn A const reference to the pawn to copy
+ * @return A record of kind PAWN, including the double jump flag
+ */
+PieceRecord PieceRecord::fromPawn(const Pawn &pawn) {
+    PieceRecord record = fromBase(pawn, PieceKind::PAWN);
+    record.doubleJumpable = pawn.canDoubleJump();
+    return record;
+}
+
+/**
+ * @brief Builds a record from a rook.
+ * @param rook A const reference to the rook to copy
+ * @return A record of kind ROOK, including the number of castle moves left
+ */
+PieceRecord PieceRecord::fromRook(const Rook &rook) {
+    PieceRecord record = fromBase(rook, PieceKind::ROOK);
+    record.castleMovesLeft = rook.getCastleMovesLeft();
+    return record;
+}
+
+/**
+ * @brief Materializes the record as a generic chess piece.
+ * @return A ChessPiece with the record's color, square and direction
+ */
+ChessPiece PieceRecord::toPiece() const {
+    return ChessPiece(colorName(color), row, column, movingUp);
+}
+
+/**
+ * @brief Materializes the record as a pawn.
+ * @return A Pawn with the record's color, square, direction and double jump flag
+ */
+Pawn PieceRecord::toPawn() const {
+    return Pawn(colorName(color), row, column, movingUp, doubleJumpable);
+}
+
+/**
+ * @brief Materializes the record as a rook.
+ * @return A Rook with the record's color, square, direction and castle moves
+ */
+Rook PieceRecord::toRook() const {
+    return Rook(colorName(color), row, column, movingUp, castleMovesLeft);
+}
+
+/**
+ * @brief Determines if the record is on the board (ie. its row and column are both in
+ *        [0, BOARD_LENGTH)).
+ * @return True if the piece is on the board. False otherwise.
+ */
+bool PieceRecord::isOnBoard() const {
+    return row >= 0 && row < ChessPiece::BOARD_LENGTH && column >= 0 && column < ChessPiece::BOARD_LENGTH;
+}
+
+/**
+ * @brief Determines if the record holds a state the piece classes can be in: a known kind,
+ *        and a row and column that are each on the board or -1. The color id is not checked.
+ * @return True if the record is valid. False otherwise.
+ */
+bool PieceRecord::isValid() const {
+    // setRow and setColumn can leave one coordinate -1 and the other on the board
+    return kind <= PieceKind::ROOK
+           && row >= -1 && row < ChessPiece::BOARD_LENGTH
+           && column >= -1 && column < ChessPiece::BOARD_LENGTH;
+}
+
+/**
+ * @brief Same rule as Pawn::canPromote, evaluated on the record.
+ * @return True if the record is a pawn on its last row. False otherwise.
+ */
+bool PieceRecord::canPromote() const {
+    return kind == PieceKind::PAWN
+           && ((movingUp && row == ChessPiece::BOARD_LENGTH - 1) || (!movingUp && row == 0));
+}
+
+/**
+ * @brief Same rule as Rook::canCastle, evaluated on two records.
+ * @param piece A const reference to the record this record may castle with
+ * @return True if this record is a rook that can castle with piece. False otherwise.
+ */
+bool PieceRecord::canCastle(const PieceRecord &piece) const {
+    return kind == PieceKind::ROOK
+           && castleMovesLeft > 0
+           && color == piece.color
+           && isOnBoard() && piece.isOnBoard()
+           && row == piece.row
+           && std::abs(column - piece.column) <= 1;
+}
+
+/**
+ * @brief Same rule as Rook::castle, applied to two records.
+ * @param piece A reference to the record this record castles with
+ * @return True if the castle was made. False otherwise (and nothing is modified).
+ */
+bool PieceRecord::castle(PieceRecord &piece) {
+    if (&piece == this || !canCastle(piece)) {
+        return false;
+    }
+    std::swap(column, piece.column);
+    --castleMovesLeft;
+    return true;
+}
+
+/**
+ * @brief Same rule as Rook::undoCastle, applied to two records.
+ * @param piece A reference to the record this record last castled with
+ */
+void PieceRecord::undoCastle(PieceRecord &piece) {
+    std::swap(column, piece.column);
+    ++castleMovesLeft;
+}
+
+/**
+ * @brief Interns a color name and returns its id.
+ *     The name is expected to already be validated and upper-cased (as ChessPiece stores it).
+ *     WHITE is always 0 and BLACK is always 1; other colors get increasing ids on first use.
+ * @param color A const reference to the color name
+ * @return The id of the color
+ */
+std::uint16_t PieceRecord::colorId(const std::string &color) {
+    ColorTable &table = colorTable();
+    std::lock_guard<std::mutex> guard(table.lock);
+    auto found = table.ids.find(color);
+    if (found != table.ids.end()) {
+        return found->second;
+    }
+    std::uint16_t id = static_cast<std::uint16_t>(table.names.size());
+    table.names.push_back(color);
+    table.ids.emplace(color, id);
+    return id;
+}
+
+/**
+ * @brief Looks up the name of an interned color.
+ * @param id A color id previously returned by colorId()
+ * @return The color name, or "BLACK" if the id is unknown
+ */
+std::string PieceRecord::colorName(std::uint16_t id) {
+    ColorTable &table = colorTable();
+    std::lock_guard<std::mutex> guard(table.lock);
+    if (id < table.names.size()) {
+        return table.names[id];
+    }
+    return "BLACK";
+}
+
+/**
+ * @return The number of interned colors; every id below it is known
+ */
+std::size_t PieceRecord::colorCount() {
+    ColorTable &table = colorTable();
+    std::lock_guard<std::mutex> guard(table.lock);
+    return table.names.size();
+}
@@ -0,0 +1,153 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PieceRecord.hpp
+ * @brief This file defines the PieceRecord struct, a packed value representation of a chess piece.
+ *
+ * A PieceRecord stores everything a ChessPiece, Pawn or Rook knows about itself in a few bytes,
+ * so large collections of pieces can be kept in contiguous arrays without materializing objects.
+ * Colors are interned into small integer ids; WHITE and BLACK always have ids 0 and 1.
+ */
+
+#ifndef CHESS_PIECE_RECORD_HPP
+#define CHESS_PIECE_RECORD_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "ChessPiece.hpp"
+#include "Pawn.hpp"
+#include "Rook.hpp"
+
+/**
+ * @brief The concrete class a record was made from.
+ */
+enum class PieceKind : std::uint8_t {
+    PIECE = 0,
+    PAWN = 1,
+    ROOK = 2
+};
+
+struct PieceRecord {
+    static const std::uint16_t WHITE = 0;
+    static const std::uint16_t BLACK = 1;
+
+    PieceKind kind;
+    std::int8_t row;            // -1 if the piece is not on the board
+    std::int8_t column;         // -1 if the piece is not on the board
+    bool movingUp;
+    bool doubleJumpable;        // Only meaningful for pawns
+    std::uint16_t color;        // Interned color id, see colorId()
+    std::int32_t castleMovesLeft;   // Only meaningful for rooks
+
+    /**
+     * @brief Default Constructor. Mirrors the default ChessPiece: a BLACK generic piece
+     *        that is not on the board and is not moving up.
+     */
+    PieceRecord();
+
+    /**
+     * @brief Builds a record from a generic chess piece.
+     * @param piece A const reference to the piece to copy
+     * @return A record of kind PIECE holding the piece's color, square and direction
+     */
+    static PieceRecord fromPiece(const ChessPiece &piece);
+
+    /**
+     * @brief Builds a record from a pawn.
+     * @param pawn A const reference to the pawn to copy
+     * @return A record of kind PAWN, including the double jump flag
+     */
+    static PieceRecord fromPawn(const Pawn &pawn);
+
+    /**
+     * @brief Builds a record from a rook.
+     * @param rook A const reference to the rook to copy
+     * @return A record of kind ROOK, including the number of castle moves left
+     */
+    static PieceRecord fromRook(const Rook &rook);
+
+    /**
+     * @brief Materializes the record as a generic chess piece.
+     * @return A ChessPiece with the record's color, square and direction
+     */
+    ChessPiece toPiece() const;
+
+    /**
+     * @brief Materializes the record as a pawn.
+     * @return A Pawn with the record's color, square, direction and double jump flag
+     */
+    Pawn toPawn() const;
+
+    /**
+     * @brief Materializes the record as a rook.
+     * @return A Rook with the record's color, square, direction and castle moves
+     */
+    Rook toRook() const;
+
+    /**
+     * @brief Determines if the record is on the board (ie. its row and column are both in
+     *        [0, BOARD_LENGTH)). Records from outside the library may hold any byte, so anything
+     *        else counts as off the board rather than as a square.
+     * @return True if the piece is on the board. False otherwise.
+     */
+    bool isOnBoard() const;
+
+    /**
+     * @brief Determines if the record holds a state the piece classes can be in: a known kind,
+     *        and a row and column that are each on the board or -1. The color id is not checked.
+     * @return True if the record is valid. False otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Same rule as Pawn::canPromote, evaluated on the record.
+     * @return True if the record is a pawn on its last row. False otherwise.
+     */
+    bool canPromote() const;
+
+    /**
+     * @brief Same rule as Rook::canCastle, evaluated on two records.
+     * @param piece A const reference to the record this record may castle with
+     * @return True if this record is a rook that can castle with piece. False otherwise.
+     */
+    bool canCastle(const PieceRecord &piece) const;
+
+    /**
+     * @brief Same rule as Rook::castle, applied to two records.
+     * @param piece A reference to the record this record castles with
+     * @return True if the castle was made. False otherwise (and nothing is modified).
+     */
+    bool castle(PieceRecord &piece);
+
+    /**
+     * @brief Same rule as Rook::undoCastle, applied to two records.
+     * @param piece A reference to the record this record last castled with
+     */
+    void undoCastle(PieceRecord &piece);
+
+    /**
+     * @brief Interns a color name and returns its id.
+     *     The name is expected to already be validated and upper-cased (as ChessPiece stores it).
+     *     WHITE is always 0 and BLACK is always 1; other colors get increasing ids on first use.
+     * @param color A const reference to the color name
+     * @return The id of the color
+     */
+    static std::uint16_t colorId(const std::string &color);
+
+    /**
+     * @brief Looks up the name of an interned color.
+     * @param id A color id previously returned by colorId()
+     * @return The color name, or "BLACK" if the id is unknown
+     */
+    static std::string colorName(std::uint16_t id);
+
+    /**
+     * @return The number of interned colors; every id below it is known
+     */
+    static std::size_t colorCount();
+};
+
+
+#endif //CHESS_PIECE_RECORD_HPP
@@ -0,0 +1,90 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PieceSlot.cpp
+ * @brief This file contains the implementation of the PieceSlot class.
+ */
+
+#include "PieceSlot.hpp"
+
+/**
+ * @brief Default Constructor. Holds a default constructed ChessPiece.
+ */
+PieceSlot::PieceSlot() : piece_(std::in_place_type<ChessPiece>) {
+}
+
+PieceSlot::PieceSlot(const ChessPiece &piece) : piece_(std::in_place_type<ChessPiece>, piece) {
+}
+
+PieceSlot::PieceSlot(const Pawn &pawn) : piece_(std::in_place_type<Pawn>, pawn) {
+}
+
+PieceSlot::PieceSlot(const Rook &rook) : piece_(std::in_place_type<Rook>, rook) {
+}
+
+/**
+ * @return The kind of piece currently held
+ */
+PieceKind PieceSlot::kind() const {
+    if (std::holds_alternative<Pawn>(piece_)) {
+        return PieceKind::PAWN;
+    }
+    if (std::holds_alternative<Rook>(piece_)) {
+        return PieceKind::ROOK;
+    }
+    return PieceKind::PIECE;
+}
+
+/**
+ * @return The held piece viewed as a ChessPiece, whatever its concrete type
+ */
+ChessPiece &PieceSlot::piece() {
+    return std::visit([](ChessPiece &held) -> ChessPiece & { return held; }, piece_);
+}
+
+const ChessPiece &PieceSlot::piece() const {
+    return std::visit([](const ChessPiece &held) -> const ChessPiece & { return held; }, piece_);
+}
+
+Pawn *PieceSlot::pawn() {
+    return std::get_if<Pawn>(&piece_);
+}
+
+const Pawn *PieceSlot::pawn() const {
+    return std::get_if<Pawn>(&piece_);
+}
+
+Rook *PieceSlot::rook() {
+    return std::get_if<Rook>(&piece_);
+}
+
+const Rook *PieceSlot::rook() const {
+    return std::get_if<Rook>(&piece_);
+}
+
+/**
+ * @brief Promotes the held pawn in place.
+ *     The slot must hold a Pawn for which Pawn::canPromote is true, and the target must
+ *     be a ROOK or a generic PIECE. The new piece keeps the pawn's color, square and direction.
+ * @param target The kind of piece to promote to
+ * @param castleMoves The castle moves given to a promoted rook. A pawn never castled, so
+ *        promoted rooks get none by default. Negative values are treated as 0, as in Rook.
+ * @post On success the slot holds the new piece; otherwise the slot is unchanged.
+ * @return True if the pawn was promoted. False otherwise.
+ */
+bool PieceSlot::promote(PieceKind target, int castleMoves) {
+    const Pawn *held = pawn();
+    if (held == nullptr || !held->canPromote() || target == PieceKind::PAWN) {
+        return false;
+    }
+
+    // The replacement is built in the variant's own storage. Colors short enough for the
+    // string's small buffer (every real color) are copied without touching the heap.
+    const Pawn old = *held;
+    if (target == PieceKind::ROOK) {
+        piece_.emplace<Rook>(old.getColor(), old.getRow(), old.getColumn(), old.isMovingUp(), castleMoves);
+    } else {
+        piece_.emplace<ChessPiece>(old.getColor(), old.getRow(), old.getColumn(), old.isMovingUp());
+    }
+    return true;
+}
@@ -0,0 +1,95 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PieceSlot.hpp
+ * @brief This file defines the PieceSlot class, a value-semantic holder for a ChessPiece, Pawn or Rook.
+ *
+ * A PieceSlot stores its piece inline (no heap allocation), so a pawn can be promoted by
+ * replacing the piece inside the slot instead of deleting the Pawn and allocating a new object.
+ * Containers of slots can be promoted in bulk with promoteAll().
+ */
+
+#ifndef CHESS_PIECE_SLOT_HPP
+#define CHESS_PIECE_SLOT_HPP
+
+
+#include <cstddef>
+#include <variant>
+#include "ChessPiece.hpp"
+#include "Pawn.hpp"
+#include "Rook.hpp"
+#include "PieceRecord.hpp"
+
+class PieceSlot {
+private:
+    std::variant<ChessPiece, Pawn, Rook> piece_;
+
+public:
+    /**
+     * @brief Default Constructor. Holds a default constructed ChessPiece.
+     */
+    PieceSlot();
+
+    /**
+     * @brief Constructors holding a copy of the given piece, keeping its concrete type.
+     */
+    PieceSlot(const ChessPiece &piece);
+    PieceSlot(const Pawn &pawn);
+    PieceSlot(const Rook &rook);
+
+    /**
+     * @return The kind of piece currently held
+     */
+    PieceKind kind() const;
+
+    /**
+     * @return The held piece viewed as a ChessPiece, whatever its concrete type
+     */
+    ChessPiece &piece();
+    const ChessPiece &piece() const;
+
+    /**
+     * @return A pointer to the held Pawn, or nullptr if the slot does not hold a pawn
+     */
+    Pawn *pawn();
+    const Pawn *pawn() const;
+
+    /**
+     * @return A pointer to the held Rook, or nullptr if the slot does not hold a rook
+     */
+    Rook *rook();
+    const Rook *rook() const;
+
+    /**
+     * @brief Promotes the held pawn in place.
+     *     The slot must hold a Pawn for which Pawn::canPromote is true, and the target must
+     *     be a ROOK or a generic PIECE. The new piece keeps the pawn's color, square and direction.
+     * @param target The kind of piece to promote to
+     * @param castleMoves The castle moves given to a promoted rook. A pawn never castled, so
+     *        promoted rooks get none by default. Negative values are treated as 0, as in Rook.
+     * @post On success the slot holds the new piece; otherwise the slot is unchanged.
+     * @return True if the pawn was promoted. False otherwise.
+     */
+    bool promote(PieceKind target, int castleMoves = 0);
+
+    /**
+     * @brief Promotes every eligible pawn in a container of slots.
+     * @param slots A range of PieceSlot (eg. std::vector<PieceSlot> or a plain array)
+     * @param target The kind of piece to promote to, see promote()
+     * @param castleMoves The castle moves given to promoted rooks, see promote()
+     * @return The number of pawns promoted
+     */
+    template<typename Slots>
+    static std::size_t promoteAll(Slots &slots, PieceKind target, int castleMoves = 0) {
+        std::size_t promoted = 0;
+        for (PieceSlot &slot : slots) {
+            if (slot.promote(target, castleMoves)) {
+                ++promoted;
+            }
+        }
+        return promoted;
+    }
+};
+
+
+#endif //CHESS_PIECE_SLOT_HPP
@@ -0,0 +1,413 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PositionDiff.cpp
+ * @brief This file contains the implementation of the position diff and patch operations.
+ *
+ * Patch format, all integers as LEB128 varints:
+ *     count, then per change:
+ *     header   bits 0-1 ChangeType, 2-3 PieceKind, 4 moving up, 5 double jump, 6 castle count follows
+ *     square   bits 0-5 the square (from, or to for ADD), 6 BLACK, 7 color id follows
+ *     to       MOVE only: the square reached
+ *     color    if flagged: the color id, above BLACK
+ *     castles  if flagged: the rook's castle moves left, zigzag encoded
+ */
+
+#include <algorithm>
+#include "BitUtil.hpp"
+#include "PositionDiff.hpp"
+
+namespace {
+    const int N = ChessPiece::BOARD_LENGTH;
+    const std::uint8_t SQUARE_MASK = Board::SQUARES - 1;
+    const std::uint8_t BLACK_BIT = 0x40;
+    const std::uint8_t WIDE_COLOR_BIT = 0x80;
+    const std::uint8_t CASTLES_BIT = 0x40;
+
+    inline Bitboard bit(int square) {
+        return Bitboard(1) << square;
+    }
+
+    // The piece moved onto a square, with the castle moves only rooks have cleared elsewhere
+    PieceRecord placed(PieceRecord piece, int square) {
+        piece.row = static_cast<std::int8_t>(square / N);
+        piece.column = static_cast<std::int8_t>(square % N);
+        if (piece.kind != PieceKind::ROOK) {
+            piece.castleMovesLeft = 0;
+        }
+        return piece;
+    }
+
+    bool sameState(const PieceRecord &a, const PieceRecord &b) {
+        return a.kind == b.kind && a.color == b.color && a.movingUp == b.movingUp && a.doubleJumpable == b.doubleJumpable
+               && (a.kind != PieceKind::ROOK || a.castleMovesLeft == b.castleMovesLeft);
+    }
+
+    // Indexes the pieces by square (-1 for empty squares); false if a piece is not valid (eg. a
+    // row past the board) or two share a square
+    bool spread(const std::vector<PieceRecord> &pieces, int *index, Bitboard &occupied) {
+        std::fill(index, index + Board::SQUARES, -1);
+        occupied = 0;
+        for (std::size_t i = 0; i < pieces.size(); ++i) {
+            if (!pieces[i].isValid()) {
+                return false;
+            }
+            if (!pieces[i].isOnBoard()) {
+                continue;
+            }
+            const int square = pieces[i].row * N + pieces[i].column;
+            if (occupied & bit(square)) {
+                return false;
+            }
+            occupied |= bit(square);
+            index[square] = static_cast<int>(i);
+        }
+        return true;
+    }
+
+    PieceRecord recordAt(const Board &board, int square) {
+        PieceRecord record;
+        if (board.kindAt(square) == Board::NO_PIECE) {
+            return record;
+        }
+        record.kind = static_cast<PieceKind>(board.kindAt(square));
+        record.movingUp = (board.movingUp() & bit(square)) != 0;
+        record.doubleJumpable = (board.doubleJumpers() & bit(square)) != 0;
+        record.color = static_cast<std::uint16_t>(board.sideAt(square));
+        record.castleMovesLeft = board.castleMovesAt(square);
+        return placed(record, square);
+    }
+
+    /*
+     * Turns the changed squares of two positions into changes. beforeAt and afterAt return the
+     * piece on a square, or a record that is not on the board if the square is empty.
+     */
+    template <typename BeforeAt, typename AfterAt>
+    void build(BeforeAt beforeAt, AfterAt afterAt, Bitboard changed, std::vector<PositionDiff::Change> &changes) {
+        if (!changed) {
+            return;
+        }
+        PieceKind departureKinds[Board::SQUARES];
+        std::uint16_t departureColors[Board::SQUARES];
+        int departureSquares[Board::SQUARES];
+        PieceKind arrivalKinds[Board::SQUARES];
+        std::uint16_t arrivalColors[Board::SQUARES];
+        int arrivalSquares[Board::SQUARES];
+        int updateSquares[Board::SQUARES];
+        int departed = 0;
+        int arrived = 0;
+        int updated = 0;
+        while (changed) {
+            const int square = BitUtil::popLsb(changed);
+            const PieceRecord had = beforeAt(square);
+            const PieceRecord has = afterAt(square);
+            if (had.isOnBoard() && has.isOnBoard() && had.color == has.color) {
+                updateSquares[updated++] = square;
+                continue;
+            }
+            if (had.isOnBoard()) {
+                departureKinds[departed] = had.kind;
+                departureColors[departed] = had.color;
+                departureSquares[departed++] = square;
+            }
+            if (has.isOnBoard()) {
+                arrivalKinds[arrived] = has.kind;
+                arrivalColors[arrived] = has.color;
+                arrivalSquares[arrived++] = square;
+            }
+        }
+
+        // Same kind first, then a pawn that promoted on the way
+        bool matched[Board::SQUARES] = {};
+        int source[Board::SQUARES];
+        for (int a = 0; a < arrived; ++a) {
+            source[a] = -1;
+            for (int pass = 0; pass < 2 && source[a] < 0; ++pass) {
+                for (int d = 0; d < departed; ++d) {
+                    const bool fits = pass == 0 ? departureKinds[d] == arrivalKinds[a]
+                                                : departureKinds[d] == PieceKind::PAWN && arrivalKinds[a] == PieceKind::ROOK;
+                    if (!matched[d] && departureColors[d] == arrivalColors[a] && fits) {
+                        matched[d] = true;
+                        source[a] = departureSquares[d];
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (int d = 0; d < departed; ++d) {
+            if (!matched[d]) {
+                const std::int8_t from = static_cast<std::int8_t>(departureSquares[d]);
+                changes.push_back({PositionDiff::REMOVE, from, -1, beforeAt(from)});
+            }
+        }
+        for (int a = 0; a < arrived; ++a) {
+            const std::int8_t to = static_cast<std::int8_t>(arrivalSquares[a]);
+            const std::int8_t from = static_cast<std::int8_t>(source[a]);
+            changes.push_back({from >= 0 ? PositionDiff::MOVE : PositionDiff::ADD, from, to, afterAt(to)});
+        }
+        for (int u = 0; u < updated; ++u) {
+            changes.push_back({PositionDiff::UPDATE, static_cast<std::int8_t>(updateSquares[u]), -1, afterAt(updateSquares[u])});
+        }
+    }
+
+    void putVarint(std::vector<std::uint8_t> &out, std::uint32_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<std::uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    bool getVarint(const std::uint8_t *&data, const std::uint8_t *end, std::uint32_t &value) {
+        value = 0;
+        for (int shift = 0; shift < 35 && data < end; shift += 7) {
+            const std::uint8_t byte = *data++;
+            value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+/**
+ * @brief Computes the changes that turn one set of pieces into another. A piece that left a
+ *        square is matched with one of the same color that arrived elsewhere (same kind first,
+ *        then a pawn becoming a rook), so a move costs one change instead of a removal and an
+ *        addition. The castle moves of pieces that are not rooks are not compared.
+ * @param before A const reference to the old pieces, in any order
+ * @param after A const reference to the new pieces, in any order
+ * @param changes A reference to a vector that receives the changes (it is cleared first)
+ * @return True if the diff was computed. False if either set has a piece that is not valid
+ *         (see PieceRecord::isValid, eg. a row outside the board) or two pieces on one square.
+ */
+bool PositionDiff::diff(const std::vector<PieceRecord> &before, const std::vector<PieceRecord> &after,
+                        std::vector<Change> &changes) {
+    changes.clear();
+    int old[Board::SQUARES];
+    int now[Board::SQUARES];
+    Bitboard hadPiece = 0;
+    Bitboard hasPiece = 0;
+    if (!spread(before, old, hadPiece) || !spread(after, now, hasPiece)) {
+        return false;
+    }
+    Bitboard changed = hadPiece ^ hasPiece;
+    Bitboard both = hadPiece & hasPiece;
+    while (both) {
+        const int square = BitUtil::popLsb(both);
+        if (!sameState(before[old[square]], after[now[square]])) {
+            changed |= bit(square);
+        }
+    }
+    const auto at = [](const std::vector<PieceRecord> &pieces, const int *index) {
+        return [&pieces, index](int square) {
+            return index[square] < 0 ? PieceRecord() : placed(pieces[index[square]], square);
+        };
+    };
+    build(at(before, old), at(after, now), changed, changes);
+    return true;
+}
+
+/**
+ * @brief Computes the changes between two boards. Only the squares whose bitboards or castle
+ *        counts differ are looked at, so the cost follows the number of changes.
+ * @param before A const reference to the old position
+ * @param after A const reference to the new position
+ * @param changes A reference to a vector that receives the changes (it is cleared first)
+ */
+void PositionDiff::diff(const Board &before, const Board &after, std::vector<Change> &changes) {
+    changes.clear();
+    Bitboard changed = (before.movingUp() ^ after.movingUp()) | (before.doubleJumpers() ^ after.doubleJumpers());
+    for (int side = Board::WHITE; side <= Board::BLACK; ++side) {
+        for (PieceKind kind : {PieceKind::PIECE, PieceKind::PAWN, PieceKind::ROOK}) {
+            changed |= before.pieces(side, kind) ^ after.pieces(side, kind);
+        }
+    }
+    Bitboard rooks = (before.pieces(Board::WHITE, PieceKind::ROOK) | before.pieces(Board::BLACK, PieceKind::ROOK)) & ~changed;
+    while (rooks) {
+        const int square = BitUtil::popLsb(rooks);
+        if (before.castleMovesAt(square) != after.castleMovesAt(square)) {
+            changed |= bit(square);
+        }
+    }
+    build([&before](int square) { return recordAt(before, square); },
+          [&after](int square) { return recordAt(after, square); }, changed, changes);
+}
+
+/**
+ * @brief Applies changes to a set of pieces. The changes take effect together, so pieces that
+ *        trade squares (a castle) need no particular order. Moved and updated pieces keep their
+ *        place in the vector, removed ones are erased and added ones appended.
+ * @param pieces A reference to the pieces to change
+ * @param changes A const reference to changes computed against these pieces
+ * @return True if the changes were applied. False if they do not fit the pieces (a piece is
+ *         not valid, two pieces share a square, a square to leave is empty or holds the other
+ *         color, a square to reach stays occupied, a square is used twice, or a change holds an
+ *         unknown kind), in which case the pieces are not modified.
+ */
+bool PositionDiff::apply(std::vector<PieceRecord> &pieces, const std::vector<Change> &changes) {
+    int index[Board::SQUARES];
+    Bitboard occupied;
+    if (!spread(pieces, index, occupied)) {
+        return false;
+    }
+
+    // Check everything before touching anything
+    Bitboard touched = 0;
+    Bitboard leaving = 0;
+    Bitboard arriving = 0;
+    for (const Change &change : changes) {
+        if (change.piece.kind > PieceKind::ROOK) {
+            return false;
+        }
+        if (change.type != ADD) {
+            if (change.from < 0 || change.from >= Board::SQUARES || (touched & bit(change.from))
+                || index[change.from] < 0 || pieces[index[change.from]].color != change.piece.color) {
+                return false;
+            }
+            touched |= bit(change.from);
+            leaving |= change.type == UPDATE ? 0 : bit(change.from);
+        }
+        if (change.type == MOVE || change.type == ADD) {
+            if (change.to < 0 || change.to >= Board::SQUARES || (arriving & bit(change.to))) {
+                return false;
+            }
+            arriving |= bit(change.to);
+        }
+    }
+    if (arriving & occupied & ~leaving) {
+        return false;
+    }
+
+    int removed[Board::SQUARES];
+    int removals = 0;
+    for (const Change &change : changes) {
+        if (change.type == MOVE) {
+            pieces[index[change.from]] = placed(change.piece, change.to);
+        } else if (change.type == UPDATE) {
+            pieces[index[change.from]] = placed(change.piece, change.from);
+        } else if (change.type == REMOVE) {
+            removed[removals++] = index[change.from];
+        }
+    }
+    if (removals > 0) {
+        std::sort(removed, removed + removals);
+        std::size_t kept = static_cast<std::size_t>(removed[0]);
+        for (std::size_t i = kept, next = 0; i < pieces.size(); ++i) {
+            if (next < static_cast<std::size_t>(removals) && static_cast<std::size_t>(removed[next]) == i) {
+                ++next;
+            } else {
+                pieces[kept++] = pieces[i];
+            }
+        }
+        pieces.resize(kept);
+    }
+    for (const Change &change : changes) {
+        if (change.type == ADD) {
+            pieces.push_back(placed(change.piece, change.to));
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Encodes changes in the compact binary patch format.
+ * @param changes A const reference to the changes
+ * @param out A reference to a buffer the patch is appended to
+ */
+void PositionDiff::encode(const std::vector<Change> &changes, std::vector<std::uint8_t> &out) {
+    putVarint(out, static_cast<std::uint32_t>(changes.size()));
+    for (const Change &change : changes) {
+        const PieceRecord &piece = change.piece;
+        const bool castles = piece.kind == PieceKind::ROOK && piece.castleMovesLeft != 0;
+        const bool wideColor = piece.color > PieceRecord::BLACK;
+        out.push_back(static_cast<std::uint8_t>(change.type | static_cast<std::uint8_t>(piece.kind) << 2
+                                                | piece.movingUp << 4 | piece.doubleJumpable << 5
+                                                | (castles ? CASTLES_BIT : 0)));
+        const int square = change.type == ADD ? change.to : change.from;
+        out.push_back(static_cast<std::uint8_t>(square | (piece.color == PieceRecord::BLACK ? BLACK_BIT : 0)
+                                                | (wideColor ? WIDE_COLOR_BIT : 0)));
+        if (change.type == MOVE) {
+            out.push_back(static_cast<std::uint8_t>(change.to));
+        }
+        if (wideColor) {
+            putVarint(out, piece.color);
+        }
+        if (castles) {
+            const std::int32_t count = piece.castleMovesLeft;
+            putVarint(out, (static_cast<std::uint32_t>(count) << 1) ^ static_cast<std::uint32_t>(count >> 31));
+        }
+    }
+}
+
+/**
+ * @brief Decodes a patch produced by encode().
+ * @param data A pointer to the patch
+ * @param size The number of bytes available at data
+ * @param changes A reference to a vector that receives the changes (it is cleared first)
+ * @return The number of bytes the patch used, or 0 if it is truncated or malformed
+ */
+std::size_t PositionDiff::decode(const std::uint8_t *data, std::size_t size, std::vector<Change> &changes) {
+    changes.clear();
+    const std::uint8_t *cursor = data;
+    const std::uint8_t *end = data + size;
+    std::uint32_t count = 0;
+    // Every change takes at least two bytes, which also bounds what a corrupt count can reserve
+    if (!getVarint(cursor, end, count) || count > static_cast<std::size_t>(end - cursor) / 2) {
+        return 0;
+    }
+    changes.reserve(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        if (end - cursor < 2) {
+            changes.clear();
+            return 0;
+        }
+        const std::uint8_t header = *cursor++;
+        const std::uint8_t squareByte = *cursor++;
+        Change change;
+        change.type = static_cast<ChangeType>(header & 3);
+        const std::uint8_t kind = (header >> 2) & 3;
+        const bool castles = (header & CASTLES_BIT) != 0;
+        if ((header & 0x80) || kind > static_cast<std::uint8_t>(PieceKind::ROOK)
+            || (castles && kind != static_cast<std::uint8_t>(PieceKind::ROOK))) {
+            changes.clear();
+            return 0;
+        }
+        const int square = squareByte & SQUARE_MASK;
+        change.from = static_cast<std::int8_t>(change.type == ADD ? -1 : square);
+        change.to = static_cast<std::int8_t>(change.type == ADD ? square : -1);
+        if (change.type == MOVE) {
+            if (cursor == end || (*cursor & ~SQUARE_MASK)) {
+                changes.clear();
+                return 0;
+            }
+            change.to = static_cast<std::int8_t>(*cursor++);
+        }
+
+        PieceRecord &piece = change.piece;
+        piece.kind = static_cast<PieceKind>(kind);
+        piece.movingUp = (header >> 4) & 1;
+        piece.doubleJumpable = (header >> 5) & 1;
+        piece.color = (squareByte & BLACK_BIT) ? PieceRecord::BLACK : PieceRecord::WHITE;
+        std::uint32_t value = 0;
+        if (squareByte & WIDE_COLOR_BIT) {
+            if ((squareByte & BLACK_BIT) || !getVarint(cursor, end, value) || value <= PieceRecord::BLACK || value > 0xFFFF) {
+                changes.clear();
+                return 0;
+            }
+            piece.color = static_cast<std::uint16_t>(value);
+        }
+        if (castles) {
+            if (!getVarint(cursor, end, value)) {
+                changes.clear();
+                return 0;
+            }
+            piece.castleMovesLeft = static_cast<std::int32_t>((value >> 1) ^ (0 - (value & 1)));
+        }
+        piece = placed(piece, change.type == MOVE || change.type == ADD ? change.to : change.from);
+        changes.push_back(change);
+    }
+    return static_cast<std::size_t>(cursor - data);
+}
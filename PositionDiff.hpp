@@ -0,0 +1,97 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PositionDiff.hpp
+ * @brief This file declares the position diff and patch operations used to sync piece sets.
+ *
+ * A diff lists what changed between two sets of PieceRecords, square by square: pieces that moved
+ * (including a pawn promoting on the way), pieces that were removed (captured) or added, and pieces
+ * whose flags changed in place (direction, double jump, castle moves). Applying the diff to the
+ * first set gives the second one, so a consumer holding the old set only needs the changes.
+ * Pieces that are not on the board are not part of a position and are ignored.
+ *
+ * The binary encoding spends 2 bytes on most changes (3 on a move), plus the castle count of a
+ * rook that still has some, so a typical ply costs 4 to 6 bytes whatever the size of the board.
+ */
+
+#ifndef CHESS_POSITION_DIFF_HPP
+#define CHESS_POSITION_DIFF_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Board.hpp"
+#include "PieceRecord.hpp"
+
+namespace PositionDiff {
+
+    enum ChangeType : std::uint8_t {
+        MOVE = 0,       // A piece left one square for another, with its state on arrival
+        REMOVE = 1,     // A piece left the board
+        ADD = 2,        // A piece appeared on an empty square
+        UPDATE = 3      // A piece stayed on its square but its kind or flags changed
+    };
+
+    struct Change {
+        ChangeType type;
+        std::int8_t from;       // The square left, removed or updated; -1 for ADD
+        std::int8_t to;         // The square reached or added; -1 for REMOVE and UPDATE
+        PieceRecord piece;      // The piece after the change (before it for REMOVE), on its square
+    };
+
+    /**
+     * @brief Computes the changes that turn one set of pieces into another. A piece that left a
+     *        square is matched with one of the same color that arrived elsewhere (same kind first,
+     *        then a pawn becoming a rook), so a move costs one change instead of a removal and an
+     *        addition. The castle moves of pieces that are not rooks are not compared.
+     * @param before A const reference to the old pieces, in any order
+     * @param after A const reference to the new pieces, in any order
+     * @param changes A reference to a vector that receives the changes (it is cleared first)
+     * @return True if the diff was computed. False if either set has a piece that is not valid
+     *         (see PieceRecord::isValid, eg. a row outside the board) or two pieces on one square.
+     */
+    bool diff(const std::vector<PieceRecord> &before, const std::vector<PieceRecord> &after,
+              std::vector<Change> &changes);
+
+    /**
+     * @brief Computes the changes between two boards. Only the squares whose bitboards or castle
+     *        counts differ are looked at, so the cost follows the number of changes.
+     * @param before A const reference to the old position
+     * @param after A const reference to the new position
+     * @param changes A reference to a vector that receives the changes (it is cleared first)
+     */
+    void diff(const Board &before, const Board &after, std::vector<Change> &changes);
+
+    /**
+     * @brief Applies changes to a set of pieces. The changes take effect together, so pieces that
+     *        trade squares (a castle) need no particular order. Moved and updated pieces keep their
+     *        place in the vector, removed ones are erased and added ones appended.
+     * @param pieces A reference to the pieces to change
+     * @param changes A const reference to changes computed against these pieces
+     * @return True if the changes were applied. False if they do not fit the pieces (a piece is
+     *         not valid, two pieces share a square, a square to leave is empty or holds the other
+     *         color, a square to reach stays occupied, a square is used twice, or a change holds an
+     *         unknown kind), in which case the pieces are not modified.
+     */
+    bool apply(std::vector<PieceRecord> &pieces, const std::vector<Change> &changes);
+
+    /**
+     * @brief Encodes changes in the compact binary patch format.
+     * @param changes A const reference to the changes
+     * @param out A reference to a buffer the patch is appended to
+     */
+    void encode(const std::vector<Change> &changes, std::vector<std::uint8_t> &out);
+
+    /**
+     * @brief Decodes a patch produced by encode().
+     * @param data A pointer to the patch
+     * @param size The number of bytes available at data
+     * @param changes A reference to a vector that receives the changes (it is cleared first)
+     * @return The number of bytes the patch used, or 0 if it is truncated or malformed
+     */
+    std::size_t decode(const std::uint8_t *data, std::size_t size, std::vector<Change> &changes);
+}
+
+
+#endif //CHESS_POSITION_DIFF_HPP
@@ -0,0 +1,182 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PositionGenerator.cpp
+ * @brief This file contains the implementation of the PositionGenerator class.
+ */
+
+#include "BitUtil.hpp"
+#include "PositionGenerator.hpp"
+
+namespace {
+    const int N = ChessPiece::BOARD_LENGTH;
+    const std::uint64_t ROW = 0xFFULL;
+
+    // Rows a pawn may stand on: never the row behind its start, its promotion row only on request
+    std::uint64_t pawnRows(int side, bool allowPromotionRow) {
+        std::uint64_t middle = ~(ROW | (ROW << (N * (N - 1))));
+        if (!allowPromotionRow) {
+            return middle;
+        }
+        return side == Board::WHITE ? middle | (ROW << (N * (N - 1))) : middle | ROW;
+    }
+
+    int startingRow(int side) {
+        return side == Board::WHITE ? 1 : N - 2;
+    }
+
+    PieceRecord makeRecord(PieceKind kind, int side, int square) {
+        PieceRecord record;
+        record.kind = kind;
+        record.color = static_cast<std::uint16_t>(side);
+        record.row = static_cast<std::int8_t>(square / N);
+        record.column = static_cast<std::int8_t>(square % N);
+        record.movingUp = side == Board::WHITE;
+        return record;
+    }
+}
+
+/**
+ * @brief Parameterized constructor.
+ * @param spec The material to place
+ * @param seed The seed shared by every thread of a run
+ * @param stream The thread's own stream number; different streams give independent sequences
+ */
+PositionGenerator::PositionGenerator(const Spec &spec, std::uint64_t seed, std::uint64_t stream)
+        : spec_(spec), random_(Random(seed ^ (stream * 0xD1B54A32D192ED03ULL)).next()), next_(BUFFER_SIZE) {
+}
+
+/**
+ * @brief Generates one position as packed records.
+ * @param out A reference to the vector the position's records are appended to
+ * @return False if the Spec cannot be placed (too many pieces, or pawns with no legal row).
+ *         Nothing is appended then.
+ */
+bool PositionGenerator::next(std::vector<PieceRecord> &out) {
+    if (!fits()) {
+        return false;
+    }
+
+    PieceRecord placed[Board::SQUARES];
+    int count = 0;
+    std::uint64_t free = ~std::uint64_t(0);
+
+    // Pawns are the most constrained, so they go first and always find a legal square
+    for (int side = 0; side < 2; ++side) {
+        std::uint64_t allowed = pawnRows(side, spec_.allowPromotionRow);
+        for (int i = 0; i < spec_.pawns[side]; ++i) {
+            int square = takeSquare(free, allowed);
+            if (square < 0) {
+                return false;
+            }
+            PieceRecord pawn = makeRecord(PieceKind::PAWN, side, square);
+            pawn.doubleJumpable = pawn.row == startingRow(side);
+            placed[count++] = pawn;
+        }
+    }
+    for (int side = 0; side < 2; ++side) {
+        for (int i = 0; i < spec_.rooks[side]; ++i) {
+            PieceRecord rook = makeRecord(PieceKind::ROOK, side, takeSquare(free, ~std::uint64_t(0)));
+            rook.castleMovesLeft = static_cast<std::int32_t>(((draw() >> 32) * (spec_.maxCastleMoves + 1)) >> 32);
+            placed[count++] = rook;
+        }
+        for (int i = 0; i < spec_.pieces[side]; ++i) {
+            placed[count++] = makeRecord(PieceKind::PIECE, side, takeSquare(free, ~std::uint64_t(0)));
+        }
+    }
+
+    out.insert(out.end(), placed, placed + count);
+    return true;
+}
+
+/**
+ * @brief Generates one position directly on a board.
+ * @param board A reference to the board; it is cleared first and WHITE is to move
+ * @return False if the Spec cannot be placed. The board is left empty then.
+ */
+bool PositionGenerator::next(Board &board) {
+    std::vector<PieceRecord> records;
+    board.clear();
+    if (!next(records)) {
+        return false;
+    }
+    for (const PieceRecord &record : records) {
+        board.place(record);
+    }
+    return true;
+}
+
+/**
+ * @brief Generates one position as piece objects.
+ * @param pawns, rooks, pieces References to the vectors the objects are appended to
+ * @return False if the Spec cannot be placed. Nothing is appended then.
+ */
+bool PositionGenerator::next(std::vector<Pawn> &pawns, std::vector<Rook> &rooks, std::vector<ChessPiece> &pieces) {
+    std::vector<PieceRecord> records;
+    if (!next(records)) {
+        return false;
+    }
+    for (const PieceRecord &record : records) {
+        if (record.kind == PieceKind::PAWN) {
+            pawns.push_back(record.toPawn());
+        } else if (record.kind == PieceKind::ROOK) {
+            rooks.push_back(record.toRook());
+        } else {
+            pieces.push_back(record.toPiece());
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Generates many positions into a PositionSet, one position each.
+ * @param positions A reference to the set the positions are added to
+ * @param count The number of positions to generate
+ * @return The number of positions generated (0 if the Spec cannot be placed)
+ */
+std::size_t PositionGenerator::generate(PositionSet &positions, std::size_t count) {
+    std::vector<PieceRecord> records;
+    std::size_t made = 0;
+    for (; made < count; ++made) {
+        records.clear();
+        if (!next(records)) {
+            break;
+        }
+        positions.beginPosition();
+        for (const PieceRecord &record : records) {
+            positions.add(record);
+        }
+    }
+    return made;
+}
+
+std::uint64_t PositionGenerator::draw() {
+    if (next_ == BUFFER_SIZE) {
+        random_.fill(buffer_, BUFFER_SIZE);
+        next_ = 0;
+    }
+    return buffer_[next_++];
+}
+
+int PositionGenerator::takeSquare(std::uint64_t &free, std::uint64_t allowed) {
+    // Pick uniformly among the legal free squares directly, so no draw is ever thrown away
+    std::uint64_t candidates = free & allowed;
+    int available = BitUtil::popcount(candidates);
+    if (available == 0) {
+        return -1;
+    }
+    int square = BitUtil::selectBit(candidates, static_cast<int>(((draw() >> 32) * available) >> 32));
+    free &= ~(std::uint64_t(1) << square);
+    return square;
+}
+
+bool PositionGenerator::fits() const {
+    int total = 0;
+    for (int side = 0; side < 2; ++side) {
+        if (spec_.pawns[side] < 0 || spec_.rooks[side] < 0 || spec_.pieces[side] < 0) {
+            return false;
+        }
+        total += spec_.pawns[side] + spec_.rooks[side] + spec_.pieces[side];
+    }
+    return total <= Board::SQUARES && spec_.maxCastleMoves >= 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file PositionGenerator.hpp
+ * @brief This file defines the PositionGenerator class, which produces random but legal placements
+ *        of Pawn, Rook and generic ChessPiece objects at high throughput.
+ *
+ * Squares are chosen without rejection: every piece draws one random number and takes the n-th
+ * free square of the set of squares it may legally stand on. Random numbers come in bulk from a
+ * RandomLanes generator. A generator built from the same (seed, stream) pair always produces the
+ * same positions, so each thread can own one stream and runs stay reproducible.
+ *
+ * The placements follow the rules the piece classes describe:
+ *   - WHITE pieces move up and BLACK pieces move down.
+ *   - A pawn never stands on the row it started behind, and stands on its promotion row
+ *     (where Pawn::canPromote holds) only if the Spec allows it.
+ *   - A pawn can double jump exactly when it stands on its starting row.
+ */
+
+#ifndef CHESS_POSITION_GENERATOR_HPP
+#define CHESS_POSITION_GENERATOR_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Board.hpp"
+#include "PieceIndex.hpp"
+#include "PieceRecord.hpp"
+#include "Random.hpp"
+
+class PositionGenerator {
+public:
+    /**
+     * @brief The material of every generated position, per side (index WHITE or BLACK).
+     *        At most Board::SQUARES pieces may be requested in total.
+     */
+    struct Spec {
+        int pawns[2] = {4, 4};
+        int rooks[2] = {1, 1};
+        int pieces[2] = {1, 1};         // Generic ChessPieces
+        bool allowPromotionRow = false;
+        int maxCastleMoves = 3;         // Rooks get a uniformly random count in [0, maxCastleMoves]
+    };
+
+private:
+    static const int BUFFER_SIZE = 256;
+
+    Spec spec_;
+    RandomLanes random_;
+    std::uint64_t buffer_[BUFFER_SIZE];
+    int next_;
+
+public:
+    /**
+     * @brief Parameterized constructor.
+     * @param spec The material to place
+     * @param seed The seed shared by every thread of a run
+     * @param stream The thread's own stream number; different streams give independent sequences
+     */
+    PositionGenerator(const Spec &spec, std::uint64_t seed, std::uint64_t stream = 0);
+
+    /**
+     * @brief Generates one position as packed records.
+     * @param out A reference to the vector the position's records are appended to
+     * @return False if the Spec cannot be placed (too many pieces, or pawns with no legal row).
+     *         Nothing is appended then.
+     */
+    bool next(std::vector<PieceRecord> &out);
+
+    /**
+     * @brief Generates one position directly on a board.
+     * @param board A reference to the board; it is cleared first and WHITE is to move
+     * @return False if the Spec cannot be placed. The board is left empty then.
+     */
+    bool next(Board &board);
+
+    /**
+     * @brief Generates one position as piece objects.
+     * @param pawns, rooks, pieces References to the vectors the objects are appended to
+     * @return False if the Spec cannot be placed. Nothing is appended then.
+     */
+    bool next(std::vector<Pawn> &pawns, std::vector<Rook> &rooks, std::vector<ChessPiece> &pieces);
+
+    /**
+     * @brief Generates many positions into a PositionSet, one position each.
+     * @param positions A reference to the set the positions are added to
+     * @param count The number of positions to generate
+     * @return The number of positions generated (0 if the Spec cannot be placed)
+     */
+    std::size_t generate(PositionSet &positions, std::size_t count);
+
+private:
+    std::uint64_t draw();
+    int takeSquare(std::uint64_t &free, std::uint64_t allowed);
+    bool fits() const;
+};
+
+
+#endif //CHESS_POSITION_GENERATOR_HPP
@@ -0,0 +1,126 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file Random.hpp
+ * @brief This file defines the Random class, a small, fast and seedable pseudo random generator.
+ *
+ * The generator is xoshiro256** seeded through SplitMix64. It is cheap to copy and keep one
+ * per thread, and two generators built from the same seed produce the same sequence.
+ * It is defined in the header so the hot loops that draw from it can inline it, and it is
+ * constexpr so tables of random keys can be generated at compile time.
+ */
+
+#ifndef CHESS_RANDOM_HPP
+#define CHESS_RANDOM_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+
+class Random {
+private:
+    std::uint64_t state_[4];
+
+    static constexpr std::uint64_t rotate(std::uint64_t value, int bits) {
+        return (value << bits) | (value >> (64 - bits));
+    }
+
+public:
+    /**
+     * @brief Parameterized constructor.
+     * @param seed Any 64 bit value. Equal seeds give equal sequences.
+     */
+    explicit constexpr Random(std::uint64_t seed = 0) : state_{} {
+        // SplitMix64 spreads the seed over the whole state, so even seed 0 is fine
+        for (std::uint64_t &word : state_) {
+            seed += 0x9E3779B97F4A7C15ULL;
+            std::uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            word = z ^ (z >> 31);
+        }
+    }
+
+    /**
+     * @return The next 64 random bits
+     */
+    constexpr std::uint64_t next() {
+        const std::uint64_t result = rotate(state_[1] * 5, 7) * 9;
+        const std::uint64_t shifted = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= shifted;
+        state_[3] = rotate(state_[3], 45);
+        return result;
+    }
+
+    /**
+     * @brief Draws a uniformly distributed integer below a bound (Lemire's multiply-shift method,
+     *        with its negligible bias left in for speed).
+     * @param bound The exclusive upper bound, greater than 0 and below 2^32
+     * @return A value in [0, bound)
+     */
+    constexpr std::uint32_t below(std::uint32_t bound) {
+        return static_cast<std::uint32_t>(((next() >> 32) * bound) >> 32);
+    }
+};
+
+/**
+ * @brief Several independent xoshiro256** generators stored lane by lane, so filling a buffer
+ *        advances all of them with the same instructions and the loop vectorizes.
+ */
+class RandomLanes {
+public:
+    static const int LANES = 8;
+
+private:
+    std::uint64_t state_[4][LANES];
+
+public:
+    /**
+     * @brief Parameterized constructor. Lane i is seeded like Random(seed * LANES + i).
+     * @param seed Any 64 bit value. Equal seeds give equal sequences.
+     */
+    explicit RandomLanes(std::uint64_t seed = 0) {
+        for (int lane = 0; lane < LANES; ++lane) {
+            Random source(seed * LANES + lane);
+            for (int word = 0; word < 4; ++word) {
+                state_[word][lane] = source.next();
+            }
+        }
+    }
+
+    /**
+     * @brief Fills a buffer with random words, LANES at a time.
+     * @param out A pointer to the buffer
+     * @param count The number of words to write. It should be a multiple of LANES; any
+     *        remainder is filled from one extra round whose unused words are dropped.
+     */
+    void fill(std::uint64_t *out, std::size_t count) {
+        std::size_t i = 0;
+        while (i < count) {
+            std::uint64_t round[LANES];
+            for (int lane = 0; lane < LANES; ++lane) {
+                std::uint64_t s1 = state_[1][lane];
+                std::uint64_t result = s1 * 5;
+                result = ((result << 7) | (result >> 57)) * 9;
+                std::uint64_t shifted = s1 << 17;
+                state_[2][lane] ^= state_[0][lane];
+                state_[3][lane] ^= s1;
+                state_[1][lane] = s1 ^ state_[2][lane];
+                state_[0][lane] ^= state_[3][lane];
+                state_[2][lane] ^= shifted;
+                state_[3][lane] = (state_[3][lane] << 45) | (state_[3][lane] >> 19);
+                round[lane] = result;
+            }
+            for (int lane = 0; lane < LANES && i < count; ++lane) {
+                out[i++] = round[lane];
+            }
+        }
+    }
+};
+
+
+#endif //CHESS_RANDOM_HPP
@@ -0,0 +1,76 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file RepetitionHistory.cpp
+ * @brief This file contains the implementation of the RepetitionHistory class.
+ */
+
+#include <algorithm>
+#include "RepetitionHistory.hpp"
+
+/**
+ * @brief Default Constructor. Creates an empty history.
+ */
+RepetitionHistory::RepetitionHistory() : keys_(), count_(0) {
+}
+
+/**
+ * @brief Starts a new history at the given position.
+ * @param board A const reference to the starting position
+ */
+void RepetitionHistory::reset(const Board &board) {
+    count_ = 0;
+    push(board);
+}
+
+/**
+ * @brief Records the position reached by a move. Call it right after Board::makeMove().
+ * @param board A const reference to the position after the move
+ */
+void RepetitionHistory::push(const Board &board) {
+    keys_[count_ & MASK] = board.key();
+    ++count_;
+}
+
+/**
+ * @brief Forgets the last position recorded. Call it right after Board::unmakeMove().
+ */
+void RepetitionHistory::pop() {
+    if (count_ > 0) {
+        --count_;
+    }
+}
+
+/**
+ * @brief Counts the earlier occurrences of the current position since the last irreversible move.
+ * @param board A const reference to the current position, which must be the last one recorded
+ * @return 0 if the position is new, 1 if it occurred once before (a twofold repetition), ...
+ */
+int RepetitionHistory::repetitions(const Board &board) const {
+    // Only reversible plies can lead back, and only an even number of them keeps the side to move
+    const int window = std::min({board.pliesSinceProgress(), count_ - 1, CAPACITY - 1});
+    const std::uint64_t key = board.key();
+    const int last = count_ - 1;
+    int found = 0;
+    for (int back = 2; back <= window; back += 2) {
+        found += keys_[(last - back) & MASK] == key;
+    }
+    return found;
+}
+
+/**
+ * @brief Determines if the current position is drawn by repetition.
+ * @param board A const reference to the current position, which must be the last one recorded
+ * @param times How many times it must have occurred in total, eg. 3 for threefold repetition
+ * @return True if it occurred at least that many times. False otherwise.
+ */
+bool RepetitionHistory::isRepetition(const Board &board, int times) const {
+    return repetitions(board) + 1 >= times;
+}
+
+/**
+ * @return The number of positions recorded since reset() (including the starting position)
+ */
+int RepetitionHistory::size() const {
+    return count_;
+}
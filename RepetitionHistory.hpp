@@ -0,0 +1,78 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file RepetitionHistory.hpp
+ * @brief This file declares the RepetitionHistory class, which detects repeated positions.
+ *
+ * The history keeps the key of every position played in a fixed ring of CAPACITY keys. A position
+ * can only repeat one reached since the last irreversible move (a pawn move, a capture or a
+ * castle, ie. since Board::pliesSinceProgress() was last reset), and only with the same side to
+ * move, so a check compares the current key against every second key of that window and never
+ * looks further back. That window is at most Board::DRAW_PLIES long, since the game is drawn
+ * there anyway, so the keys it reads span a handful of cache lines.
+ */
+
+#ifndef CHESS_REPETITION_HISTORY_HPP
+#define CHESS_REPETITION_HISTORY_HPP
+
+
+#include <cstdint>
+#include "Board.hpp"
+
+class RepetitionHistory {
+public:
+    static const int CAPACITY = 128;    // A power of two above Board::DRAW_PLIES
+
+private:
+    static const int MASK = CAPACITY - 1;
+    static_assert((CAPACITY & MASK) == 0 && CAPACITY > Board::DRAW_PLIES, "the ring must hold the whole window");
+
+    std::uint64_t keys_[CAPACITY];
+    int count_;                         // Keys pushed since reset(); the ring keeps the last CAPACITY
+
+public:
+    /**
+     * @brief Default Constructor. Creates an empty history.
+     */
+    RepetitionHistory();
+
+    /**
+     * @brief Starts a new history at the given position.
+     * @param board A const reference to the starting position
+     */
+    void reset(const Board &board);
+
+    /**
+     * @brief Records the position reached by a move. Call it right after Board::makeMove().
+     * @param board A const reference to the position after the move
+     */
+    void push(const Board &board);
+
+    /**
+     * @brief Forgets the last position recorded. Call it right after Board::unmakeMove().
+     */
+    void pop();
+
+    /**
+     * @brief Counts the earlier occurrences of the current position since the last irreversible move.
+     * @param board A const reference to the current position, which must be the last one recorded
+     * @return 0 if the position is new, 1 if it occurred once before (a twofold repetition), ...
+     */
+    int repetitions(const Board &board) const;
+
+    /**
+     * @brief Determines if the current position is drawn by repetition.
+     * @param board A const reference to the current position, which must be the last one recorded
+     * @param times How many times it must have occurred in total, eg. 3 for threefold repetition
+     * @return True if it occurred at least that many times. False otherwise.
+     */
+    bool isRepetition(const Board &board, int times = 3) const;
+
+    /**
+     * @return The number of positions recorded since reset() (including the starting position)
+     */
+    int size() const;
+};
+
+
+#endif //CHESS_REPETITION_HISTORY_HPP
@@ -84,6 +84,42 @@ bool Rook::canCastle(const ChessPiece& piece) const {
     return true;
 }
 
+/**
+ * @brief Castles this rook with the parameter Chess Piece, if canCastle allows it.
+ *     The rook and the piece trade columns (the rook hops over its laterally adjacent partner)
+ *     and castle_moves_left_ is decremented, all in one step: either everything changes or nothing does.
+ * @param ChessPiece A reference to the chess piece to castle with
+ * @post If the castle was made, the columns are swapped and castle_moves_left_ is one smaller
+ * @return True if the castle was made. False otherwise (and nothing is modified).
+ */
+bool Rook::castle(ChessPiece& piece) {
+    // A rook always "can castle" with itself, but there is nothing to hop over
+    if (&piece == this || !canCastle(piece)) {
+        return false;
+    }
+
+    // Both columns are on the board, so neither setColumn can take a piece off the board
+    int column = this->getColumn();
+    this->setColumn(piece.getColumn());
+    piece.setColumn(column);
+    castle_moves_left_--;
+    return true;
+}
+
+/**
+ * @brief Undoes the last castle made with the parameter Chess Piece.
+ *     The columns are swapped back and castle_moves_left_ is incremented.
+ * @param ChessPiece A reference to the chess piece this rook last castled with.
+ *     Undoing a castle that was never made gives unspecified results.
+ * @post The rook and the piece are back on their squares from before the castle
+ */
+void Rook::undoCastle(ChessPiece& piece) {
+    int column = this->getColumn();
+    this->setColumn(piece.getColumn());
+    piece.setColumn(column);
+    castle_moves_left_++;
+}
+
 /**
  * @brief Gets the value of the castle_moves_left_
  * @return The integer value stored in castle_moves_left_
@@ -91,3 +127,37 @@ bool Rook::canCastle(const ChessPiece& piece) const {
 int Rook::getCastleMovesLeft() const {
     return castle_moves_left_;
 }
+
+/**
+ * @brief Compares two rooks: the ChessPiece attributes and the castle moves left.
+ * @param other A const reference to the rook to compare with
+ * @return True if everything matches. False otherwise.
+ */
+bool Rook::operator==(const Rook &other) const {
+    return castle_moves_left_ == other.castle_moves_left_ && ChessPiece::operator==(other);
+}
+
+bool Rook::operator!=(const Rook &other) const {
+    return !(*this == other);
+}
+
+/**
+ * @brief Orders rooks as ChessPiece does, then by the castle moves left.
+ * @param other A const reference to the rook to compare with
+ * @return True if this rook comes first. False otherwise.
+ */
+bool Rook::operator<(const Rook &other) const {
+    if (ChessPiece::operator<(other)) {
+        return true;
+    }
+    return !other.ChessPiece::operator<(*this) && castle_moves_left_ < other.castle_moves_left_;
+}
+
+/**
+ * @brief Extends ChessPiece::hash() with the castle moves left, and with a tag so that a rook and a
+ *        ChessPiece with the same attributes hash apart. std::hash<Rook> calls it.
+ * @return The hash value
+ */
+std::size_t Rook::hash() const {
+    return combine(ChessPiece::hash(), HASH_TAG | static_cast<std::uint32_t>(castle_moves_left_));
+}
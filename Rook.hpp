@@ -17,6 +17,8 @@
 
 class Rook: public ChessPiece {
 private:
+    static const std::uint64_t HASH_TAG = 2ULL << 40;   // Above every ChessPiece field and the castle moves
+
     int castle_moves_left_;
 
 public:
@@ -62,13 +64,63 @@ public:
      */
     bool canCastle(const ChessPiece& piece) const;
 
+    /**
+     * @brief Castles this rook with the parameter Chess Piece, if canCastle allows it.
+     *     The rook and the piece trade columns (the rook hops over its laterally adjacent partner)
+     *     and castle_moves_left_ is decremented, all in one step: either everything changes or nothing does.
+     * @param ChessPiece A reference to the chess piece to castle with
+     * @post If the castle was made, the columns are swapped and castle_moves_left_ is one smaller
+     * @return True if the castle was made. False otherwise (and nothing is modified).
+     */
+    bool castle(ChessPiece& piece);
+
+    /**
+     * @brief Undoes the last castle made with the parameter Chess Piece.
+     *     The columns are swapped back and castle_moves_left_ is incremented.
+     * @param ChessPiece A reference to the chess piece this rook last castled with.
+     *     Undoing a castle that was never made gives unspecified results.
+     * @post The rook and the piece are back on their squares from before the castle
+     */
+    void undoCastle(ChessPiece& piece);
+
     /**
      * @brief Gets the value of the castle_moves_left_
      * @return The integer value stored in castle_moves_left_
  */
     int getCastleMovesLeft() const;
+
+    /**
+     * @brief Compares two rooks: the ChessPiece attributes and the castle moves left.
+     * @param other A const reference to the rook to compare with
+     * @return True if everything matches. False otherwise.
+     */
+    bool operator==(const Rook &other) const;
+    bool operator!=(const Rook &other) const;
+
+    /**
+     * @brief Orders rooks as ChessPiece does, then by the castle moves left.
+     * @param other A const reference to the rook to compare with
+     * @return True if this rook comes first. False otherwise.
+     */
+    bool operator<(const Rook &other) const;
+
+    /**
+     * @brief Extends ChessPiece::hash() with the castle moves left, and with a tag so that a rook and a
+     *        ChessPiece with the same attributes hash apart. std::hash<Rook> calls it.
+     * @return The hash value
+     */
+    std::size_t hash() const;
 };
 
+namespace std {
+    template <>
+    struct hash<Rook> {
+        std::size_t operator()(const Rook &rook) const {
+            return rook.hash();
+        }
+    };
+}
+
 
 #endif //CHESS_ROOK_HPP
 
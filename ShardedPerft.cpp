@@ -0,0 +1,252 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file ShardedPerft.cpp
+ * @brief This file contains the implementation of the multi-process sharded perft.
+ */
+
+#include <atomic>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "HashMemory.hpp"
+#include "Perft.hpp"
+#include "ShardedPerft.hpp"
+
+namespace {
+    const std::uint64_t MAGIC = 0x5348415244504654ULL;     // "SHARDPFT"
+
+    // A shard's claim is PENDING, DONE, or the process id of the worker running it
+    const std::int64_t PENDING = 0;
+    const std::int64_t DONE = -1;
+
+    // How long the coordinator sleeps between two looks at its workers
+    const useconds_t POLL_MICROSECONDS = 10000;
+
+    struct Header {
+        std::uint64_t magic;
+        std::uint64_t rootKey;
+        std::int32_t depth;
+        std::int32_t shardCount;
+        std::uint64_t tableEntries;
+    };
+
+    struct Shard {
+        std::atomic<std::int64_t> claim;
+        std::atomic<std::uint64_t> leaves;
+        std::uint16_t move;
+    };
+
+    struct Segment {
+        void *base = MAP_FAILED;
+        std::size_t bytes = 0;
+        Header *header = nullptr;
+        Shard *shards = nullptr;
+        PerftTable::Entry *entries = nullptr;
+    };
+
+    std::size_t shardOffset() {
+        return (sizeof(Header) + 63) / 64 * 64;
+    }
+
+    std::size_t tableOffset(std::size_t shardCount) {
+        return (shardOffset() + shardCount * sizeof(Shard) + 63) / 64 * 64;
+    }
+
+    // Maps the segment, creating or resizing it as needed. Fresh pages read as zero.
+    bool mapSegment(const ShardedPerft::Options &options, std::size_t bytes, Segment &segment) {
+        if (options.name.empty()) {
+            segment.base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        } else {
+            int fd = shm_open(options.name.c_str(), O_RDWR | O_CREAT, 0600);
+            if (fd < 0) {
+                return false;
+            }
+            struct stat info;
+            if (fstat(fd, &info) != 0
+                || (static_cast<std::size_t>(info.st_size) != bytes && ftruncate(fd, 0) != 0)
+                || ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+                close(fd);
+                return false;
+            }
+            segment.base = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+        }
+        segment.bytes = bytes;
+        if (segment.base == MAP_FAILED) {
+            return false;
+        }
+        // Honoured for shared memory only when the system enables huge pages for shmem
+        HashMemory::adviseHugePages(segment.base, bytes);
+        return true;
+    }
+
+    // Runs in a forked child: claims pending shards until none are left
+    void worker(const Board &root, int depth, Segment &segment) {
+        PerftTable table(segment.entries, segment.header->tableEntries);
+        const std::int64_t self = getpid();
+
+        for (std::int32_t i = 0; i < segment.header->shardCount; ++i) {
+            // Claiming and recording the owner is one step, so a crash can never orphan a shard
+            Shard &shard = segment.shards[i];
+            std::int64_t expected = PENDING;
+            if (!shard.claim.compare_exchange_strong(expected, self)) {
+                continue;
+            }
+
+            Board board = root;
+            Move move = Move::fromRaw(shard.move);
+            Board::Undo undo = board.makeMove(move);
+            std::uint64_t leaves = Perft::count(board, depth - 1, table);
+            board.unmakeMove(move, undo);
+
+            shard.leaves.store(leaves);
+            shard.claim.store(DONE);
+        }
+    }
+
+    pid_t startWorker(const Board &root, int depth, Segment &segment) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            worker(root, depth, segment);
+            _exit(0);
+        }
+        return pid;
+    }
+}
+
+/**
+ * @brief Runs perft to the given depth, one root move per shard.
+ * @param board A const reference to the root position
+ * @param depth The depth to count to, at least 1
+ * @param options The process count, table size and segment name
+ * @return The total and per-move counts, plus how the shards were obtained
+ */
+ShardedPerft::Result ShardedPerft::run(const Board &board, int depth, const Options &options) {
+    Result result;
+    result.complete = false;
+    result.leaves = 0;
+    result.shardsComputed = 0;
+    result.shardsReused = 0;
+    result.restarts = 0;
+
+    MoveList moves;
+    board.generateMoves(moves);
+    const std::size_t shardCount = moves.size();
+    std::size_t entries = 2;
+    while (entries * 2 * sizeof(PerftTable::Entry) <= options.tableMegabytes * 1024 * 1024) {
+        entries *= 2;
+    }
+
+    Segment segment;
+    if (!mapSegment(options, tableOffset(shardCount) + entries * sizeof(PerftTable::Entry), segment)) {
+        return result;
+    }
+    char *base = static_cast<char *>(segment.base);
+    segment.header = reinterpret_cast<Header *>(base);
+    segment.shards = reinterpret_cast<Shard *>(base + shardOffset());
+    segment.entries = reinterpret_cast<PerftTable::Entry *>(base + tableOffset(shardCount));
+
+    // A segment left behind by an earlier run of the same perft keeps its finished shards;
+    // anything else is wiped and laid out from scratch
+    Header &header = *segment.header;
+    bool resume = header.magic == MAGIC && header.rootKey == board.key() && header.depth == depth
+                  && header.shardCount == static_cast<std::int32_t>(shardCount) && header.tableEntries == entries;
+    if (!resume) {
+        header.magic = 0;
+        for (std::size_t i = 0; i < shardCount; ++i) {
+            Shard *shard = new(&segment.shards[i]) Shard;
+            shard->claim.store(PENDING);
+            shard->leaves.store(0);
+            shard->move = moves[static_cast<int>(i)].raw();
+        }
+        PerftTable(segment.entries, entries).clear();
+        header.rootKey = board.key();
+        header.depth = depth;
+        header.shardCount = static_cast<std::int32_t>(shardCount);
+        header.tableEntries = entries;
+        header.magic = MAGIC;
+    }
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        std::int64_t claim = segment.shards[i].claim.load();
+        if (claim == DONE) {
+            ++result.shardsReused;
+        } else if (claim != PENDING) {
+            // Its worker belonged to a coordinator that is gone
+            segment.shards[i].claim.store(PENDING);
+        }
+    }
+
+    // Only our own workers are waited for, so other children of the caller are left alone
+    std::vector<pid_t> workers;
+    bool failed = false;
+    const unsigned processes = options.processes > 0 ? options.processes : 1;
+    for (unsigned p = 0; p < processes && depth > 1; ++p) {
+        pid_t pid = startWorker(board, depth, segment);
+        if (pid > 0) {
+            workers.push_back(pid);
+        }
+    }
+
+    while (!workers.empty()) {
+        bool reaped = false;
+        for (std::size_t w = 0; w < workers.size(); ++w) {
+            int status = 0;
+            const pid_t child = workers[w];
+            pid_t waited = waitpid(child, &status, WNOHANG);
+            if (waited == 0) {
+                continue;
+            }
+            reaped = true;
+            workers.erase(workers.begin() + static_cast<std::ptrdiff_t>(w));
+            --w;
+            if (waited > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+                continue;
+            }
+
+            // The worker died: hand its shard back and start a replacement
+            for (std::size_t i = 0; i < shardCount; ++i) {
+                std::int64_t claim = child;
+                segment.shards[i].claim.compare_exchange_strong(claim, PENDING);
+            }
+            if (static_cast<int>(result.restarts) >= options.maxRestarts) {
+                failed = true;
+                continue;
+            }
+            ++result.restarts;
+            pid_t replacement = startWorker(board, depth, segment);
+            if (replacement > 0) {
+                workers.push_back(replacement);
+            }
+        }
+        if (!reaped) {
+            usleep(POLL_MICROSECONDS);
+        }
+    }
+
+    // At depth 1 there is nothing to fork for: each root move is a single leaf
+    result.complete = !failed;
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        Shard &shard = segment.shards[i];
+        if (depth <= 1) {
+            shard.leaves.store(1);
+            shard.claim.store(DONE);
+        }
+        if (shard.claim.load() != DONE) {
+            result.complete = false;
+            continue;
+        }
+        result.perMove.emplace_back(Move::fromRaw(shard.move), shard.leaves.load());
+        result.leaves += shard.leaves.load();
+    }
+    result.shardsComputed = static_cast<unsigned>(result.perMove.size()) - result.shardsReused;
+
+    munmap(segment.base, segment.bytes);
+    if (result.complete && !options.name.empty() && !options.keepSegment) {
+        shm_unlink(options.name.c_str());
+    }
+    return result;
+}
@@ -0,0 +1,59 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file ShardedPerft.hpp
+ * @brief This file declares ShardedPerft, which runs a deep perft across several worker processes.
+ *
+ * The coordinator splits the root moves into shards and forks worker processes that claim
+ * shards one at a time. Everything the workers share lives in one POSIX shared memory segment:
+ * the shard table (state, owner and result of every root move) followed by a PerftTable that
+ * all workers read and fill, so a subtree counted by one process is a hit for the others.
+ *
+ * A worker that dies only loses the shard it was running: the coordinator puts that shard back
+ * to pending and forks a replacement. When the segment is named, it also survives the
+ * coordinator; running again with the same name, position and depth reuses every finished shard.
+ * POSIX systems only.
+ */
+
+#ifndef CHESS_SHARDED_PERFT_HPP
+#define CHESS_SHARDED_PERFT_HPP
+
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Board.hpp"
+
+namespace ShardedPerft {
+
+    struct Options {
+        unsigned processes = 2;
+        std::size_t tableMegabytes = 64;
+        std::string name;           // A shm_open name such as "/perft-run". Empty for an anonymous segment.
+        bool keepSegment = false;   // Leave a named segment behind after a successful run
+        int maxRestarts = 16;       // Worker crashes tolerated before giving up
+    };
+
+    struct Result {
+        bool complete;              // False if the segment could not be set up or too many workers died
+        std::uint64_t leaves;
+        std::vector<std::pair<Move, std::uint64_t>> perMove;
+        unsigned shardsComputed;    // Shards finished by this run
+        unsigned shardsReused;      // Shards found already finished in a named segment
+        unsigned restarts;          // Workers that died and were replaced
+    };
+
+    /**
+     * @brief Runs perft to the given depth, one root move per shard.
+     * @param board A const reference to the root position
+     * @param depth The depth to count to, at least 1
+     * @param options The process count, table size and segment name
+     * @return The total and per-move counts, plus how the shards were obtained
+     */
+    Result run(const Board &board, int depth, const Options &options);
+}
+
+
+#endif //CHESS_SHARDED_PERFT_HPP
@@ -0,0 +1,322 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file TexelTuner.cpp
+ * @brief This file contains the implementation of the TexelTuner class.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include "TexelTuner.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    // Positions per vector lane group and per block; the block arrays stay in L1
+    const std::size_t LANES = 16;
+    const std::size_t BLOCK = 256;
+
+    const char *NAMES[Features::COLUMNS] = {"pawn", "pawn advance", "rook", "rook mobility", "rook open file",
+                                            "rook half-open file", "piece"};
+
+    std::size_t roundUp(std::size_t value, std::size_t multiple) {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+
+    // Computes, for scores[0 .. padded), the logistic loss against the half point results (added
+    // to the loss lanes) and its derivative probability - result (written to errors), written so
+    // neither exp nor log can overflow. Entries from count on are padding and contribute nothing.
+    // exp and log1p are polynomials rather than libm calls, which would keep the loops scalar.
+    void logistic(const float *scores, const std::uint8_t *results, std::size_t count, std::size_t padded,
+                  float *errors, float *lossLanes) {
+        const float LOG2E = 1.44269504f;
+        const float LN2 = 0.693147181f;
+        const float LIMIT = 126;
+        std::int32_t limitBits;
+        std::memcpy(&limitBits, &LIMIT, sizeof(limitBits));
+        float magnitudes[BLOCK];
+        float fractions[BLOCK];
+        std::int32_t bits[BLOCK];
+        float powers[BLOCK];
+
+        // |score| in base 2, at most 126 so that 2^-n stays a normal float. Non-negative floats
+        // order like their bit patterns, and comparing those as integers keeps the loop
+        // vectorizable where a float comparison (which may trap) would not be.
+        for (std::size_t i = 0; i < padded; ++i) {
+            magnitudes[i] = std::fabs(scores[i]) * LOG2E;
+        }
+        std::memcpy(bits, magnitudes, padded * sizeof(float));
+        for (std::size_t i = 0; i < padded; ++i) {
+            bits[i] = std::min(bits[i], limitBits);
+        }
+        std::memcpy(magnitudes, bits, padded * sizeof(float));
+
+        // exp(-|score|) = 2^n * 2^f with n an integer and |f| <= 1/2
+        for (std::size_t i = 0; i < padded; ++i) {
+            const float t = -magnitudes[i];
+            const std::int32_t n = static_cast<std::int32_t>(t - 0.5f);
+            const float x = (t - static_cast<float>(n)) * LN2;
+            fractions[i] = 1 + x * (1 + x * (1.0f / 2 + x * (1.0f / 6 + x * (1.0f / 24 + x * (1.0f / 120 + x * (1.0f / 720))))));
+            bits[i] = (n + 127) << 23;
+        }
+        std::memcpy(powers, bits, padded * sizeof(float));
+
+        for (std::size_t i = 0; i < padded; i += LANES) {
+            for (std::size_t lane = 0; lane < LANES; ++lane) {
+                const std::size_t k = i + lane;
+                const float score = scores[k];
+                const float result = 0.5f * static_cast<float>(results[k]);
+                const float decay = fractions[k] * powers[k];
+                // 1 / (1 + decay) for a positive score, decay / (1 + decay) for a negative one
+                const float probability = 0.5f + std::copysign(0.5f * (1 - decay) / (1 + decay), score);
+
+                // log1p(decay) = 2 atanh(s) with s = decay / (2 + decay) <= 1/3
+                const float s = decay / (2 + decay);
+                const float s2 = s * s;
+                const float softplus = 2 * s * (1 + s2 * (1.0f / 3 + s2 * (1.0f / 5 + s2 * (1.0f / 7 + s2 * (1.0f / 9 + s2 * (1.0f / 11))))));
+
+                // Computed for the padding too (a zero score) and masked, so nothing is conditional
+                const float valid = k < count ? 1.0f : 0.0f;
+                lossLanes[lane] += valid * (0.5f * (score + std::fabs(score)) + softplus - result * score);
+                errors[k] = valid * (probability - result);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Parameterized constructor.
+ * @param options The thread count, loss scale and stopping rule
+ */
+TexelTuner::TexelTuner(const Options &options) : options_(options), count_(0) {
+}
+
+/**
+ * @brief Reserves room for positions that are about to be added.
+ * @param count The number of positions expected in total
+ */
+void TexelTuner::reserve(std::size_t count) {
+    for (std::vector<std::int16_t> &column : columns_) {
+        column.reserve(roundUp(count, LANES));
+    }
+    results_.reserve(roundUp(count, LANES));
+}
+
+/**
+ * @brief Adds a labeled position. Only its features are kept.
+ * @param board A const reference to the position
+ * @param result The score WHITE ended with: 1, 0.5 or 0
+ * @return True if the position was added. False if the result is not one of those values.
+ */
+bool TexelTuner::add(const Board &board, double result) {
+    if (result != 0 && result != 0.5 && result != 1) {
+        return false;
+    }
+    std::int16_t row[Features::WIDTH];
+    Features::extract(board, row);
+
+    // Grow by whole lane groups so the kernels never need a scalar tail
+    if (count_ % LANES == 0) {
+        for (std::vector<std::int16_t> &column : columns_) {
+            column.resize(count_ + LANES, 0);
+        }
+        results_.resize(count_ + LANES, 0);
+    }
+    for (int j = 0; j < Features::COLUMNS; ++j) {
+        columns_[j][count_] = static_cast<std::int16_t>(row[j] - row[Features::COLUMNS + j]);
+    }
+    results_[count_] = static_cast<std::uint8_t>(result * 2);
+    ++count_;
+    return true;
+}
+
+/**
+ * @return The number of positions added
+ */
+std::size_t TexelTuner::size() const {
+    return count_;
+}
+
+/**
+ * @param weights The weights to score the positions with
+ * @return The mean logistic loss over every position, or 0 if there are none
+ */
+double TexelTuner::loss(const Weights &weights) const {
+    Weights unused;
+    return gradient(weights, unused);
+}
+
+/**
+ * @brief Runs Adam from the given weights until the loss converges or maxIterations is reached.
+ * @param start The weights to start from
+ * @return The tuned weights and the run statistics
+ */
+TexelTuner::Report TexelTuner::tune(const Weights &start) const {
+    const double beta1 = 0.9;
+    const double beta2 = 0.999;
+    const double epsilon = 1e-8;
+
+    Clock::time_point begin = Clock::now();
+    Report report;
+    report.converged = false;
+    report.iterations = 0;
+
+    // Adam overshoots and comes back, so the loss is not monotonic: keep the best weights seen
+    Weights weights = start;
+    Weights moment{};
+    Weights variance{};
+    Weights slope;
+    double power1 = 1;
+    double power2 = 1;
+    int stalled = 0;
+    report.startLoss = gradient(weights, slope);
+    report.loss = report.startLoss;
+    report.weights = weights;
+    while (report.iterations < options_.maxIterations) {
+        power1 *= beta1;
+        power2 *= beta2;
+        for (int j = 0; j < Features::COLUMNS; ++j) {
+            moment[j] = beta1 * moment[j] + (1 - beta1) * slope[j];
+            variance[j] = beta2 * variance[j] + (1 - beta2) * slope[j] * slope[j];
+            weights[j] -= options_.learningRate * (moment[j] / (1 - power1))
+                          / (std::sqrt(variance[j] / (1 - power2)) + epsilon);
+        }
+        ++report.iterations;
+
+        const double loss = gradient(weights, slope);
+        stalled = loss < report.loss - options_.tolerance ? 0 : stalled + 1;
+        if (loss < report.loss) {
+            report.loss = loss;
+            report.weights = weights;
+        }
+        if (stalled >= PATIENCE) {
+            report.converged = true;
+            break;
+        }
+    }
+    report.seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+    return report;
+}
+
+/**
+ * @return Usual starting weights: 100 for a pawn, 500 for a rook, 300 for a generic piece and
+ *         0 for the positional terms
+ */
+TexelTuner::Weights TexelTuner::defaultWeights() {
+    Weights weights{};
+    weights[Features::PAWNS] = 100;
+    weights[Features::ROOKS] = 500;
+    weights[Features::PIECES] = 300;
+    return weights;
+}
+
+/**
+ * @brief Prints the weights, one named term per line.
+ * @param weights The weights to print
+ */
+void TexelTuner::display(const Weights &weights) {
+    for (int j = 0; j < Features::COLUMNS; ++j) {
+        std::cout << NAMES[j] << ": " << weights[j] << std::endl;
+    }
+}
+
+// Computes the mean loss at the weights and its gradient, splitting the positions over the threads
+double TexelTuner::gradient(const Weights &weights, Weights &gradient) const {
+    gradient.fill(0);
+    if (count_ == 0) {
+        return 0;
+    }
+
+    // The kernels score in log odds, so the centipawn weights are scaled once here
+    const double logOdds = std::log(10.0) / options_.scale;
+    float scaled[Features::COLUMNS];
+    for (int j = 0; j < Features::COLUMNS; ++j) {
+        scaled[j] = static_cast<float>(weights[j] * logOdds);
+    }
+
+    unsigned threadCount = options_.threads;
+    if (threadCount == 0) {
+        threadCount = std::thread::hardware_concurrency();
+    }
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+    // Whole blocks per thread, so only the last chunk ends inside a block
+    const std::size_t chunk = roundUp((count_ + threadCount - 1) / threadCount, BLOCK);
+    threadCount = static_cast<unsigned>((count_ + chunk - 1) / chunk);
+
+    std::vector<std::array<double, Features::COLUMNS + 1>> sums(threadCount);
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < threadCount; ++t) {
+        threads.emplace_back(&TexelTuner::accumulate, this, t * chunk, std::min(count_, (t + 1) * chunk),
+                             scaled, sums[t].data());
+    }
+    accumulate(0, std::min(count_, chunk), scaled, sums[0].data());
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+
+    double loss = 0;
+    for (const std::array<double, Features::COLUMNS + 1> &partial : sums) {
+        for (int j = 0; j < Features::COLUMNS; ++j) {
+            gradient[j] += partial[j];
+        }
+        loss += partial[Features::COLUMNS];
+    }
+    for (int j = 0; j < Features::COLUMNS; ++j) {
+        gradient[j] *= logOdds / static_cast<double>(count_);
+    }
+    return loss / static_cast<double>(count_);
+}
+
+// Adds the loss of positions [begin, end) to sums[COLUMNS] and its derivatives with respect to
+// the scaled weights to sums[0 .. COLUMNS)
+void TexelTuner::accumulate(std::size_t begin, std::size_t end, const float *weights, double *sums) const {
+    std::fill(sums, sums + Features::COLUMNS + 1, 0.0);
+    float score[BLOCK];
+    float error[BLOCK];
+
+    for (std::size_t first = begin; first < end; first += BLOCK) {
+        const std::size_t count = std::min(BLOCK, end - first);
+        const std::size_t padded = roundUp(count, LANES);
+
+        for (std::size_t i = 0; i < padded; ++i) {
+            score[i] = 0;
+        }
+        for (int j = 0; j < Features::COLUMNS; ++j) {
+            const std::int16_t *column = columns_[j].data() + first;
+            const float weight = weights[j];
+            for (std::size_t i = 0; i < padded; ++i) {
+                score[i] += weight * static_cast<float>(column[i]);
+            }
+        }
+
+        // Cross-entropy of the sigmoid; its derivative with respect to the score is simply
+        // probability - result
+        float lossLanes[LANES] = {};
+        logistic(score, results_.data() + first, count, padded, error, lossLanes);
+        for (float lane : lossLanes) {
+            sums[Features::COLUMNS] += lane;
+        }
+
+        // One partial sum per lane keeps the float reduction vectorizable without -ffast-math
+        for (int j = 0; j < Features::COLUMNS; ++j) {
+            const std::int16_t *column = columns_[j].data() + first;
+            float lanes[LANES] = {};
+            for (std::size_t i = 0; i < padded; i += LANES) {
+                for (std::size_t lane = 0; lane < LANES; ++lane) {
+                    lanes[lane] += error[i + lane] * static_cast<float>(column[i + lane]);
+                }
+            }
+            double total = 0;
+            for (float lane : lanes) {
+                total += lane;
+            }
+            sums[j] += total;
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file TexelTuner.hpp
+ * @brief This file defines the TexelTuner class, which fits the weights of a linear evaluation
+ *        to the results of many labeled positions.
+ *
+ * The evaluation is a weighted sum of the Features columns, WHITE minus BLACK, in centipawns. A
+ * position scored e is expected to end with WHITE scoring 1 / (1 + 10^(-e / scale)), and the
+ * tuner minimizes the logistic (cross-entropy) loss between that and the recorded results.
+ *
+ * Positions are reduced to their feature differences when they are added and kept column by
+ * column as 16 bit integers, 15 bytes a position. Each gradient evaluation splits the positions
+ * over the threads; inside a thread they are processed in blocks whose loops run over fixed
+ * lanes, so the compiler vectorizes the score and gradient sums. The partial sums are added in
+ * thread order, so a run is deterministic for a given thread count. Steps use Adam, which copes
+ * with columns on very different scales (counts versus mobility), until the loss stops improving.
+ */
+
+#ifndef CHESS_TEXEL_TUNER_HPP
+#define CHESS_TEXEL_TUNER_HPP
+
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Board.hpp"
+#include "Features.hpp"
+
+class TexelTuner {
+public:
+    // One weight per Features::Column, in centipawns per unit
+    typedef std::array<double, Features::COLUMNS> Weights;
+
+    struct Options {
+        unsigned threads = 0;               // 0 uses every hardware thread
+        double scale = 400;                 // Centipawns per factor of 10 in the odds of winning
+        double learningRate = 1;            // Adam step size, in centipawns
+        int maxIterations = 5000;
+        double tolerance = 1e-7;            // Stop after PATIENCE iterations without beating the best loss by this
+    };
+
+    struct Report {
+        Weights weights;            // The weights with the lowest loss seen
+        double startLoss;           // Mean loss of the starting weights
+        double loss;                // Mean loss of the returned weights
+        int iterations;
+        bool converged;             // False if maxIterations ran out first
+        double seconds;
+    };
+
+    // Iterations the best loss may go without improving by more than the tolerance
+    static const int PATIENCE = 50;
+
+private:
+    Options options_;
+    std::size_t count_;
+    std::vector<std::int16_t> columns_[Features::COLUMNS];  // WHITE minus BLACK, padded with zeros to whole lanes
+    std::vector<std::uint8_t> results_;                     // Half points for WHITE: win 2, draw 1, loss 0; padded too
+
+public:
+    /**
+     * @brief Parameterized constructor.
+     * @param options The thread count, loss scale and stopping rule
+     */
+    explicit TexelTuner(const Options &options);
+
+    /**
+     * @brief Reserves room for positions that are about to be added.
+     * @param count The number of positions expected in total
+     */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Adds a labeled position. Only its features are kept.
+     * @param board A const reference to the position
+     * @param result The score WHITE ended with: 1, 0.5 or 0
+     * @return True if the position was added. False if the result is not one of those values.
+     */
+    bool add(const Board &board, double result);
+
+    /**
+     * @return The number of positions added
+     */
+    std::size_t size() const;
+
+    /**
+     * @param weights The weights to score the positions with
+     * @return The mean logistic loss over every position, or 0 if there are none
+     */
+    double loss(const Weights &weights) const;
+
+    /**
+     * @brief Runs Adam from the given weights until the loss converges or maxIterations is reached.
+     * @param start The weights to start from
+     * @return The tuned weights and the run statistics
+     */
+    Report tune(const Weights &start) const;
+
+    /**
+     * @return Usual starting weights: 100 for a pawn, 500 for a rook, 300 for a generic piece and
+     *         0 for the positional terms
+     */
+    static Weights defaultWeights();
+
+    /**
+     * @brief Prints the weights, one named term per line.
+     * @param weights The weights to print
+     */
+    static void display(const Weights &weights);
+
+private:
+    double gradient(const Weights &weights, Weights &gradient) const;
+    void accumulate(std::size_t begin, std::size_t end, const float *weights, double *sums) const;
+};
+
+
+#endif //CHESS_TEXEL_TUNER_HPP
@@ -0,0 +1,178 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file batch_replay.cpp
+ * @brief Benchmark: replaying many recorded games one Board at a time versus in a BoardBatch.
+ *
+ * Random games are recorded from a common opening position, then replayed to the end twice: game
+ * after game with Board::isLegal and Board::makeMove, and in lockstep with BoardBatch::apply,
+ * one ply of every game per call. Games that already ended get a null move (a square to itself),
+ * which every lane rejects. The final positions of the two replays are compared.
+ *
+ * Replayed games never hold a promotable pawn, since makeMove promotes a pawn as soon as it reaches
+ * its last row. The promotion scan therefore runs on generated positions with pawns allowed on
+ * their last rows, one per lane: BoardBatch::promotable is timed against a scan of each Board, and
+ * its pawns are compared square by square with Pawn::canPromote.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O3 -march=native -std=c++17 -I. bench/batch_replay.cpp BoardBatch.cpp PositionGenerator.cpp \
+ *         PieceIndex.cpp Board.cpp PieceRecord.cpp ChessPiece.cpp Pawn.cpp Rook.cpp -o batch_replay
+ *     ./batch_replay [games, default 4096] [plies, default 80]
+ * On AVX-512 machines -mprefer-vector-width=512 lets BoardBatch::apply use the full register.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "BoardBatch.hpp"
+#include "PositionGenerator.hpp"
+#include "Random.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const int REPEATS = 10;
+
+    Board opening() {
+        Board board;
+        for (int column = 0; column < ChessPiece::BOARD_LENGTH; ++column) {
+            board.place(Pawn("white", 1, column, true, true));
+            board.place(Pawn("black", 6, column, false, true));
+        }
+        board.place(Rook("white", 0, 0, true, 2));
+        board.place(Rook("white", 0, 7, true, 2));
+        board.place(ChessPiece("white", 0, 4, true));
+        board.place(Rook("black", 7, 0, false, 2));
+        board.place(Rook("black", 7, 7, false, 2));
+        board.place(ChessPiece("black", 7, 4, false));
+        return board;
+    }
+
+    // The same position rebuilt from scratch, so boards reached in different ways compare by key
+    std::uint64_t canonicalKey(const Board &board) {
+        Board copy;
+        for (const PieceRecord &record : board.pieces()) {
+            copy.place(record);
+        }
+        copy.setSideToMove(board.sideToMove());
+        return copy.key();
+    }
+
+    double elapsed(Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t games = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+    const int plies = argc > 2 ? std::atoi(argv[2]) : 80;
+    const Board start = opening();
+    const Move none(0, 0);
+
+    // Record the games ply-major, as the batch consumes them
+    std::vector<Move> recorded(games * plies, none);
+    std::size_t total = 0;
+    Random random(7);
+    for (std::size_t game = 0; game < games; ++game) {
+        Board board = start;
+        for (int ply = 0; ply < plies; ++ply) {
+            MoveList moves;
+            board.generateMoves(moves);
+            if (moves.size() == 0) {
+                break;
+            }
+            recorded[ply * games + game] = moves[static_cast<int>(random.below(static_cast<std::uint32_t>(moves.size())))];
+            board.makeMove(recorded[ply * games + game]);
+            ++total;
+        }
+    }
+
+    std::vector<Board> boards(games);
+    Clock::time_point begin = Clock::now();
+    std::size_t scalarPlayed = 0;
+    for (int repeat = 0; repeat < REPEATS; ++repeat) {
+        for (std::size_t game = 0; game < games; ++game) {
+            Board &board = boards[game];
+            board = start;
+            for (int ply = 0; ply < plies; ++ply) {
+                const Move &move = recorded[ply * games + game];
+                if (board.isLegal(move)) {
+                    board.makeMove(move);
+                    ++scalarPlayed;
+                }
+            }
+        }
+    }
+    const double scalar = elapsed(begin) / REPEATS;
+
+    BoardBatch batch(games);
+    std::vector<std::uint8_t> applied(games);
+    double batched = 0;
+    std::size_t batchPlayed = 0;
+    for (int repeat = 0; repeat < REPEATS; ++repeat) {
+        for (std::size_t game = 0; game < games; ++game) {
+            batch.load(game, start);
+        }
+        begin = Clock::now();
+        for (int ply = 0; ply < plies; ++ply) {
+            batchPlayed += batch.apply(&recorded[ply * games], applied.data());
+        }
+        batched += elapsed(begin);
+    }
+    batched /= REPEATS;
+
+    std::size_t mismatches = 0;
+    for (std::size_t game = 0; game < games; ++game) {
+        Board board;
+        batch.store(game, board);
+        mismatches += canonicalKey(board) != canonicalKey(boards[game]);
+    }
+
+    // Fresh positions with pawns allowed on their last rows, so some lanes can promote
+    PositionGenerator::Spec spec;
+    spec.allowPromotionRow = true;
+    PositionGenerator generator(spec, 11);
+    for (std::size_t game = 0; game < games; ++game) {
+        generator.next(boards[game]);
+        batch.load(game, boards[game]);
+    }
+
+    const Bitboard lastRow = 0xFFULL << (Board::SQUARES - ChessPiece::BOARD_LENGTH);
+    begin = Clock::now();
+    std::size_t scalarPromotable = 0;
+    for (const Board &board : boards) {
+        const Bitboard pawns = board.pieces(Board::WHITE, PieceKind::PAWN)
+                               | board.pieces(Board::BLACK, PieceKind::PAWN);
+        scalarPromotable += ((pawns & board.movingUp() & lastRow) | (pawns & ~board.movingUp() & 0xFFULL)) != 0;
+    }
+    const double scalarScan = elapsed(begin);
+    std::vector<Bitboard> promoting(games);
+    begin = Clock::now();
+    const std::size_t batchPromotable = batch.promotable(promoting.data());
+    const double batchScan = elapsed(begin);
+
+    // The pawns the batch reports must be exactly those Pawn::canPromote accepts
+    std::size_t promotionMismatches = 0;
+    for (std::size_t game = 0; game < games; ++game) {
+        Bitboard expected = 0;
+        for (const PieceRecord &record : boards[game].pieces()) {
+            if (record.kind == PieceKind::PAWN && record.toPawn().canPromote()) {
+                expected |= Bitboard(1) << (record.row * ChessPiece::BOARD_LENGTH + record.column);
+            }
+        }
+        promotionMismatches += promoting[game] != expected;
+    }
+
+    std::cout << games << " games, " << total << " plies recorded" << std::endl;
+    std::cout << "replay    board " << scalar / total << " ns/ply   batch " << batched / total << " ns/ply   speedup "
+              << scalar / batched << "x" << std::endl;
+    std::cout << "promote   board " << scalarScan / games << " ns/game  batch " << batchScan / games << " ns/game   "
+              << scalarPromotable << " / " << batchPromotable << " of " << games << " positions, "
+              << promotionMismatches << " differing from Pawn::canPromote" << std::endl;
+    std::cout << "played " << scalarPlayed / REPEATS << " / " << batchPlayed / REPEATS << ", final positions differing: "
+              << mismatches << std::endl;
+    return mismatches == 0 && scalarPlayed == batchPlayed && scalarPromotable == batchPromotable
+           && promotionMismatches == 0 && batchPromotable != 0 ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file diff_sync.cpp
+ * @brief Benchmark: syncing a consumer ply by ply with full piece lists versus position patches.
+ *
+ * Random games are played from an opening position. After every ply the producer either encodes
+ * the whole piece list (the patch from an empty board) or the patch from the previous position,
+ * and a consumer holding the previous piece list decodes and applies it. Reports bytes and
+ * nanoseconds per ply for both, and checks that the consumer always ends up with the producer's
+ * pieces. Finally checks that diff and apply reject piece sets with a row or column outside the
+ * board (leaving the consumer unchanged), while a piece half off the board, at (-1, column), is
+ * taken as off the board.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O2 -std=c++17 -I. bench/diff_sync.cpp PositionDiff.cpp Board.cpp PieceRecord.cpp \
+ *         ChessPiece.cpp Pawn.cpp Rook.cpp -o diff_sync
+ *     ./diff_sync [games, default 2000]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "PositionDiff.hpp"
+#include "Random.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const int PLIES = 80;
+
+    Board opening() {
+        Board board;
+        for (int column = 0; column < ChessPiece::BOARD_LENGTH; ++column) {
+            board.place(Pawn("white", 1, column, true, true));
+            board.place(Pawn("black", 6, column, false, true));
+        }
+        board.place(Rook("white", 0, 0, true, 2));
+        board.place(Rook("white", 0, 7, true, 2));
+        board.place(ChessPiece("white", 0, 4, true));
+        board.place(Rook("black", 7, 0, false, 2));
+        board.place(Rook("black", 7, 7, false, 2));
+        board.place(ChessPiece("black", 7, 4, false));
+        return board;
+    }
+
+    bool samePieces(std::vector<PieceRecord> a, std::vector<PieceRecord> b) {
+        const auto bySquare = [](const PieceRecord &x, const PieceRecord &y) {
+            return x.row * ChessPiece::BOARD_LENGTH + x.column < y.row * ChessPiece::BOARD_LENGTH + y.column;
+        };
+        std::sort(a.begin(), a.end(), bySquare);
+        std::sort(b.begin(), b.end(), bySquare);
+        if (a.size() != b.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < a.size(); ++i) {
+            if (a[i].kind != b[i].kind || a[i].row != b[i].row || a[i].column != b[i].column || a[i].color != b[i].color
+                || a[i].movingUp != b[i].movingUp || a[i].doubleJumpable != b[i].doubleJumpable
+                || (a[i].kind == PieceKind::ROOK && a[i].castleMovesLeft != b[i].castleMovesLeft)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const int games = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const Board start = opening();
+    Random random(11);
+
+    // Record the positions first so both syncs replay exactly the same plies
+    std::vector<std::vector<Board>> played(games);
+    std::size_t plies = 0;
+    for (int game = 0; game < games; ++game) {
+        Board board = start;
+        played[game].push_back(board);
+        for (int ply = 0; ply < PLIES; ++ply) {
+            MoveList moves;
+            board.generateMoves(moves);
+            if (moves.size() == 0) {
+                break;
+            }
+            board.makeMove(moves[static_cast<int>(random.below(static_cast<std::uint32_t>(moves.size())))]);
+            played[game].push_back(board);
+            ++plies;
+        }
+    }
+
+    std::vector<PositionDiff::Change> changes;
+    std::vector<std::uint8_t> wire;
+    const std::vector<PieceRecord> empty;
+    std::size_t fullBytes = 0;
+    std::size_t patchBytes = 0;
+    std::size_t failures = 0;
+
+    Clock::time_point begin = Clock::now();
+    for (const std::vector<Board> &positions : played) {
+        std::vector<PieceRecord> consumer = positions[0].pieces();
+        for (std::size_t ply = 1; ply < positions.size(); ++ply) {
+            wire.clear();
+            PositionDiff::diff(empty, positions[ply].pieces(), changes);
+            PositionDiff::encode(changes, wire);
+            fullBytes += wire.size();
+            consumer.clear();
+            failures += PositionDiff::decode(wire.data(), wire.size(), changes) != wire.size()
+                        || !PositionDiff::apply(consumer, changes);
+        }
+        failures += !samePieces(consumer, positions.back().pieces());
+    }
+    const double full = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+
+    begin = Clock::now();
+    for (const std::vector<Board> &positions : played) {
+        std::vector<PieceRecord> consumer = positions[0].pieces();
+        for (std::size_t ply = 1; ply < positions.size(); ++ply) {
+            wire.clear();
+            PositionDiff::diff(positions[ply - 1], positions[ply], changes);
+            PositionDiff::encode(changes, wire);
+            patchBytes += wire.size();
+            failures += PositionDiff::decode(wire.data(), wire.size(), changes) != wire.size()
+                        || !PositionDiff::apply(consumer, changes);
+        }
+        failures += !samePieces(consumer, positions.back().pieces());
+    }
+    const double patched = std::chrono::duration<double, std::nano>(Clock::now() - begin).count();
+
+    // Pieces from outside: every out-of-range coordinate must be refused, not indexed
+    std::size_t accepted = 0;
+    std::vector<PositionDiff::Change> unused;
+    const std::vector<PieceRecord> first = played[0][0].pieces();
+    PositionDiff::diff(first, played[0][1].pieces(), changes);
+    const int bad[4][2] = {{12, 0}, {0, 8}, {-5, 3}, {3, -2}};
+    for (const int (&square)[2] : bad) {
+        std::vector<PieceRecord> pieces = first;
+        pieces[0].row = static_cast<std::int8_t>(square[0]);
+        pieces[0].column = static_cast<std::int8_t>(square[1]);
+        const std::vector<PieceRecord> copy = pieces;
+        accepted += PositionDiff::diff(pieces, first, unused) || PositionDiff::diff(first, pieces, unused);
+        accepted += PositionDiff::apply(pieces, changes) || !samePieces(pieces, copy);
+    }
+    std::vector<PieceRecord> halfOff = first;
+    halfOff[0].row = -1;
+    failures += !PositionDiff::diff(halfOff, first, unused);
+
+    std::cout << games << " games, " << plies << " plies" << std::endl;
+    std::cout << "full list  " << static_cast<double>(fullBytes) / plies << " bytes/ply  " << full / plies << " ns/ply"
+              << std::endl;
+    std::cout << "patch      " << static_cast<double>(patchBytes) / plies << " bytes/ply  " << patched / plies
+              << " ns/ply" << std::endl;
+    std::cout << "consumer mismatches: " << failures << ", out-of-range pieces accepted: " << accepted << std::endl;
+    return failures == 0 && accepted == 0 ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file endgame_probe.cpp
+ * @brief Benchmark: the cost of asking the Endgame table on every position, and what it does for
+ *        a search in the rook ending.
+ *
+ * Times Endgame::evaluate, over and over on a few positions as a search would, on positions from
+ * the position generator (no evaluator, the common case) and on random rook endings (a rook and a generic piece against a lone generic piece).
+ * Then runs a short MctsEngine search on rook endings where the side with the rook is to move,
+ * and counts how often it picks a move that wins, compared with what the evaluator says.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O2 -std=c++17 -pthread -I. bench/endgame_probe.cpp Endgame.cpp MctsEngine.cpp HashMemory.cpp \
+ *         PositionGenerator.cpp PieceIndex.cpp Board.cpp PieceRecord.cpp ChessPiece.cpp Pawn.cpp Rook.cpp \
+ *         -o endgame_probe
+ *     ./endgame_probe [positions, default 1000] [searches, default 200]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Endgame.hpp"
+#include "MctsEngine.hpp"
+#include "PositionGenerator.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const char *COLORS[2] = {"white", "black"};
+    const int ROUNDS = 100;
+
+    Board rookEnding(Random &random, int strong) {
+        int squares[3];
+        do {
+            for (int &square : squares) {
+                square = static_cast<int>(random.below(Board::SQUARES));
+            }
+        } while (squares[0] == squares[1] || squares[0] == squares[2] || squares[1] == squares[2]);
+        const int n = ChessPiece::BOARD_LENGTH;
+        Board board;
+        board.place(Rook(COLORS[strong], squares[0] / n, squares[0] % n, random.below(2) != 0, 0));
+        board.place(ChessPiece(COLORS[strong], squares[1] / n, squares[1] % n, true));
+        board.place(ChessPiece(COLORS[strong ^ 1], squares[2] / n, squares[2] % n, false));
+        board.setSideToMove(strong);
+        return board;
+    }
+
+    // Several rounds over positions that fit in cache, as in a search that keeps asking
+    double nanosecondsPer(const std::vector<Board> &boards, std::size_t &found) {
+        Clock::time_point start = Clock::now();
+        for (int round = 0; round < ROUNDS; ++round) {
+            for (const Board &board : boards) {
+                int score;
+                found += Endgame::evaluate(board, score);
+            }
+        }
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (ROUNDS * boards.size());
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000;
+    const int searches = argc > 2 ? std::atoi(argv[2]) : 200;
+    Random random(41);
+
+    std::vector<Board> generated(count);
+    PositionGenerator generator(PositionGenerator::Spec(), 43);
+    for (Board &board : generated) {
+        generator.next(board);
+    }
+    std::vector<Board> endings;
+    for (std::size_t i = 0; i < count; ++i) {
+        endings.push_back(rookEnding(random, static_cast<int>(random.below(2))));
+    }
+
+    std::size_t misses = 0;
+    std::size_t hits = 0;
+    const double miss = nanosecondsPer(generated, misses);
+    const double hit = nanosecondsPer(endings, hits);
+    std::cout << "evaluate, no evaluator    " << miss << " ns/position (" << misses << " found)" << std::endl;
+    std::cout << "evaluate, rook ending     " << hit << " ns/position (" << hits << " found)" << std::endl;
+
+    MctsEngine::Options options;
+    options.threads = 1;
+    options.playouts = 2000;
+    options.nodeCapacity = 1 << 16;
+    MctsEngine engine(options);
+    int winnable = 0;
+    int found = 0;
+    for (int i = 0; i < searches; ++i) {
+        Board board = rookEnding(random, static_cast<int>(random.below(2)));
+        int score = 0;
+        Endgame::evaluate(board, score);
+        if (score <= 0) {
+            continue;
+        }
+        ++winnable;
+        board.makeMove(engine.search(board).best);
+        MoveList moves;
+        board.generateMoves(moves);
+        found += board.result(moves) == Board::SIDE_TO_MOVE_LOST;
+    }
+    std::cout << "search found the win in " << found << " of " << winnable << " winnable rook endings" << std::endl;
+    return found == winnable ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file feature_extract.cpp
+ * @brief Benchmark: computing evaluation features piece by piece from Pawn and Rook objects
+ *        versus Features::extract on the bitboards.
+ *
+ * Random positions are generated, then their features are computed twice: by turning every piece
+ * into its object and walking the board square by square from getRow() and getColumn(), as a
+ * caller without the bitboards would, and with Features::extract. The two feature matrices are
+ * compared, and the per-piece rows of Features::extractPieces are checked against the position
+ * rows.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O2 -march=native -std=c++17 -I. bench/feature_extract.cpp Features.cpp PositionGenerator.cpp \
+ *         PieceIndex.cpp Board.cpp PieceRecord.cpp ChessPiece.cpp Pawn.cpp Rook.cpp -o feature_extract
+ *     ./feature_extract [positions, default 1000000]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Features.hpp"
+#include "PositionGenerator.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const int N = ChessPiece::BOARD_LENGTH;
+
+    bool hasPawn(const Board &board, int column, int side) {
+        for (int row = 0; row < N; ++row) {
+            if (board.kindAt(row * N + column) == static_cast<int>(PieceKind::PAWN) && board.sideAt(row * N + column) == side) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Features from the piece objects, one square at a time
+    void slowExtract(const Board &board, std::int16_t *row) {
+        for (int i = 0; i < Features::WIDTH; ++i) {
+            row[i] = 0;
+        }
+        for (const PieceRecord &record : board.pieces()) {
+            std::int16_t *values = row + record.color * Features::COLUMNS;
+            if (record.kind == PieceKind::PAWN) {
+                const Pawn pawn = record.toPawn();
+                ++values[Features::PAWNS];
+                values[Features::PAWN_ADVANCE] += pawn.isMovingUp() ? pawn.getRow() : N - 1 - pawn.getRow();
+            } else if (record.kind == PieceKind::ROOK) {
+                const Rook rook = record.toRook();
+                ++values[Features::ROOKS];
+                const int rowStep[4] = {1, -1, 0, 0};
+                const int columnStep[4] = {0, 0, 1, -1};
+                for (int direction = 0; direction < 4; ++direction) {
+                    int r = rook.getRow() + rowStep[direction];
+                    int c = rook.getColumn() + columnStep[direction];
+                    for (; r >= 0 && r < N && c >= 0 && c < N; r += rowStep[direction], c += columnStep[direction]) {
+                        const int side = board.sideAt(r * N + c);
+                        if (side != Board::NO_PIECE) {
+                            values[Features::ROOK_MOBILITY] += side != record.color;
+                            break;
+                        }
+                        ++values[Features::ROOK_MOBILITY];
+                    }
+                }
+                const bool own = hasPawn(board, rook.getColumn(), record.color);
+                const bool enemy = hasPawn(board, rook.getColumn(), record.color ^ 1);
+                values[Features::ROOK_OPEN_FILE] += !own && !enemy;
+                values[Features::ROOK_HALF_OPEN_FILE] += !own && enemy;
+            } else {
+                ++values[Features::PIECES];
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    PositionGenerator::Spec spec;
+    spec.pawns[0] = spec.pawns[1] = 6;
+    spec.rooks[0] = spec.rooks[1] = 2;
+    PositionGenerator generator(spec, 17);
+    std::vector<Board> boards(count);
+    for (Board &board : boards) {
+        generator.next(board);
+    }
+
+    std::vector<std::int16_t> slow(count * Features::WIDTH);
+    Clock::time_point start = Clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        slowExtract(boards[i], slow.data() + i * Features::WIDTH);
+    }
+    const double objects = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    std::vector<std::int16_t> fast;
+    start = Clock::now();
+    Features::extract(boards, fast);
+    const double bitboards = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    std::vector<std::int8_t> pieces;
+    std::vector<std::size_t> rows(count);
+    start = Clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        rows[i] = Features::extractPieces(boards[i], pieces);
+    }
+    const double perPiece = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    // The per-piece rows add up to the position rows
+    std::size_t mismatches = slow != fast;
+    std::vector<std::int16_t> sums(count * Features::WIDTH, 0);
+    std::size_t position = 0;
+    std::size_t left = count > 0 ? rows[0] : 0;
+    for (std::size_t i = 0; i < pieces.size(); i += Features::PIECE_COLUMNS) {
+        while (left == 0) {
+            left = rows[++position];
+        }
+        --left;
+        std::int16_t *values = sums.data() + position * Features::WIDTH + pieces[i + Features::SIDE] * Features::COLUMNS;
+        if (pieces[i + Features::KIND] == static_cast<int>(PieceKind::PAWN)) {
+            ++values[Features::PAWNS];
+            values[Features::PAWN_ADVANCE] += pieces[i + Features::ADVANCE];
+        } else if (pieces[i + Features::KIND] == static_cast<int>(PieceKind::ROOK)) {
+            ++values[Features::ROOKS];
+            values[Features::ROOK_MOBILITY] += pieces[i + Features::MOBILITY];
+            values[Features::ROOK_OPEN_FILE] += pieces[i + Features::FILE_STATUS] == 2;
+            values[Features::ROOK_HALF_OPEN_FILE] += pieces[i + Features::FILE_STATUS] == 1;
+        } else {
+            ++values[Features::PIECES];
+        }
+    }
+    mismatches += sums != fast;
+
+    std::cout << count << " positions" << std::endl;
+    std::cout << "objects          " << objects / count << " ns/position" << std::endl;
+    std::cout << "extract          " << bitboards / count << " ns/position   " << objects / bitboards << "x" << std::endl;
+    std::cout << "extractPieces    " << perPiece / count << " ns/position" << std::endl;
+    std::cout << "mismatches: " << mismatches << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
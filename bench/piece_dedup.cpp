@@ -0,0 +1,118 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file piece_dedup.cpp
+ * @brief Benchmark: removing duplicate pieces with display()-style string keys versus the pieces'
+ *        own hash, equality and ordering.
+ *
+ * A stream of pawns and rooks is drawn from a smaller pool, so most of it is duplicates. Each
+ * strategy counts the distinct pieces: an unordered_set of strings formatted like display(), an
+ * unordered_set of the pieces themselves (std::hash and operator==), and sort plus unique
+ * (operator< and operator==). Also reports how evenly the hash spreads the pool over buckets.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O2 -std=c++17 -I. bench/piece_dedup.cpp ChessPiece.cpp Pawn.cpp Rook.cpp -o piece_dedup
+ *     ./piece_dedup [stream length, default 2000000] [pool size, default 20000]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "Pawn.hpp"
+#include "Random.hpp"
+#include "Rook.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const char *COLORS[] = {"white", "black", "red", "green"};
+
+    // What the callers did before: the display() line, plus the subclass state
+    std::string key(const Pawn &pawn) {
+        std::ostringstream out;
+        out << pawn.getColor() << " piece at (" << pawn.getRow() << "," << pawn.getColumn() << ") is moving "
+            << (pawn.isMovingUp() ? "UP" : "DOWN") << " pawn " << pawn.canDoubleJump();
+        return out.str();
+    }
+
+    std::string key(const Rook &rook) {
+        std::ostringstream out;
+        out << rook.getColor() << " piece at (" << rook.getRow() << "," << rook.getColumn() << ") is moving "
+            << (rook.isMovingUp() ? "UP" : "DOWN") << " rook " << rook.getCastleMovesLeft();
+        return out.str();
+    }
+
+    double nanosecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    template <typename Piece>
+    void run(const char *name, const std::vector<Piece> &stream) {
+        Clock::time_point start = Clock::now();
+        std::unordered_set<std::string> keys;
+        for (const Piece &piece : stream) {
+            keys.insert(key(piece));
+        }
+        const double strings = nanosecondsSince(start);
+
+        start = Clock::now();
+        std::unordered_set<Piece> set;
+        for (const Piece &piece : stream) {
+            set.insert(piece);
+        }
+        const double hashed = nanosecondsSince(start);
+
+        start = Clock::now();
+        std::vector<Piece> sorted = stream;
+        std::sort(sorted.begin(), sorted.end());
+        const std::size_t unique = static_cast<std::size_t>(std::unique(sorted.begin(), sorted.end()) - sorted.begin());
+        const double ordered = nanosecondsSince(start);
+
+        // Pieces per bucket for the occupied buckets; 1.0 is a perfect spread
+        std::size_t occupied = 0;
+        for (std::size_t bucket = 0; bucket < set.bucket_count(); ++bucket) {
+            occupied += set.bucket_size(bucket) != 0;
+        }
+
+        const double count = static_cast<double>(stream.size());
+        std::cout << name << ": " << set.size() << " distinct (" << keys.size() << " / " << unique << ")" << std::endl;
+        std::cout << "    string keys   " << strings / count << " ns/piece" << std::endl;
+        std::cout << "    std::hash     " << hashed / count << " ns/piece   " << strings / hashed << "x, "
+                  << static_cast<double>(set.size()) / occupied << " per used bucket at load "
+                  << set.load_factor() << std::endl;
+        std::cout << "    sort+unique   " << ordered / count << " ns/piece   " << strings / ordered << "x" << std::endl;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t length = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000000;
+    const std::size_t poolSize = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+    Random random(3);
+
+    std::vector<Pawn> pawnPool;
+    std::vector<Rook> rookPool;
+    for (std::size_t i = 0; i < poolSize; ++i) {
+        const char *color = COLORS[random.below(4)];
+        const int row = static_cast<int>(random.below(ChessPiece::BOARD_LENGTH));
+        const int column = static_cast<int>(random.below(ChessPiece::BOARD_LENGTH));
+        const bool up = random.below(2) != 0;
+        pawnPool.emplace_back(color, row, column, up, random.below(2) != 0);
+        rookPool.emplace_back(color, row, column, up, static_cast<int>(random.below(64)));
+    }
+
+    std::vector<Pawn> pawns;
+    std::vector<Rook> rooks;
+    for (std::size_t i = 0; i < length; ++i) {
+        pawns.push_back(pawnPool[random.below(static_cast<std::uint32_t>(poolSize))]);
+        rooks.push_back(rookPool[random.below(static_cast<std::uint32_t>(poolSize))]);
+    }
+
+    run("pawns", pawns);
+    run("rooks", rooks);
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file piece_sort.cpp
+ * @brief Benchmark: putting large arrays of pieces into board order with std::stable_sort versus
+ *        the PieceOrder radix sort.
+ *
+ * Random records (a few colors, about 1 in 16 off the board) are sorted by (color, row, column)
+ * three ways: std::stable_sort of the records with a comparator, std::stable_sort of an index
+ * permutation, and PieceOrder with and without the permutation. Checks that all of them agree.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O2 -std=c++17 -I. bench/piece_sort.cpp PieceOrder.cpp PieceRecord.cpp ChessPiece.cpp \
+ *         Pawn.cpp Rook.cpp -o piece_sort
+ *     ./piece_sort [pieces, default 1000000] [colors, default 4]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <vector>
+#include "PieceOrder.hpp"
+#include "Random.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const int REPEATS = 5;
+
+    int key(const PieceRecord &piece) {
+        if (!piece.isOnBoard()) {
+            return 1 << 30;
+        }
+        return piece.color * 64 + piece.row * ChessPiece::BOARD_LENGTH + piece.column;
+    }
+
+    bool same(const PieceRecord &a, const PieceRecord &b) {
+        return a.kind == b.kind && a.row == b.row && a.column == b.column && a.color == b.color
+               && a.movingUp == b.movingUp && a.doubleJumpable == b.doubleJumpable
+               && a.castleMovesLeft == b.castleMovesLeft;
+    }
+
+    double nanosecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    const std::uint32_t colors = argc > 2 ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 4;
+    const char *names[] = {"white", "black", "red", "green", "blue", "yellow", "purple", "orange"};
+    Random random(5);
+
+    std::vector<PieceRecord> pieces(count);
+    for (PieceRecord &piece : pieces) {
+        const int row = random.below(16) == 0 ? -1 : static_cast<int>(random.below(ChessPiece::BOARD_LENGTH));
+        const int column = static_cast<int>(random.below(ChessPiece::BOARD_LENGTH));
+        const char *color = names[random.below(std::min<std::uint32_t>(colors, 8))];
+        piece = random.below(2) == 0
+                ? PieceRecord::fromPawn(Pawn(color, row, column, random.below(2) != 0, random.below(2) != 0))
+                : PieceRecord::fromRook(Rook(color, row, column, random.below(2) != 0, static_cast<int>(random.below(3))));
+    }
+    const auto byKey = [](const PieceRecord &a, const PieceRecord &b) { return key(a) < key(b); };
+
+    double comparator = 0, indexed = 0, radix = 0, radixIndexed = 0;
+    std::size_t mismatches = 0;
+    for (int repeat = 0; repeat < REPEATS; ++repeat) {
+        std::vector<PieceRecord> expected = pieces;
+        Clock::time_point start = Clock::now();
+        std::stable_sort(expected.begin(), expected.end(), byKey);
+        comparator += nanosecondsSince(start);
+
+        std::vector<std::size_t> permutation(count);
+        start = Clock::now();
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::stable_sort(permutation.begin(), permutation.end(),
+                         [&](std::size_t a, std::size_t b) { return key(pieces[a]) < key(pieces[b]); });
+        indexed += nanosecondsSince(start);
+
+        std::vector<PieceRecord> sorted = pieces;
+        start = Clock::now();
+        PieceOrder::sortBySquare(sorted);
+        radix += nanosecondsSince(start);
+        for (std::size_t i = 0; i < count; ++i) {
+            mismatches += !same(sorted[i], expected[i]);
+        }
+
+        std::vector<std::size_t> radixPermutation;
+        sorted = pieces;
+        start = Clock::now();
+        PieceOrder::sortBySquare(sorted, &radixPermutation);
+        radixIndexed += nanosecondsSince(start);
+        mismatches += radixPermutation != permutation;
+    }
+
+    const double total = static_cast<double>(count) * REPEATS;
+    std::cout << count << " pieces, " << colors << " colors" << std::endl;
+    std::cout << "stable_sort records       " << comparator / total << " ns/piece" << std::endl;
+    std::cout << "stable_sort permutation   " << indexed / total << " ns/piece" << std::endl;
+    std::cout << "radix records             " << radix / total << " ns/piece   " << comparator / radix << "x" << std::endl;
+    std::cout << "radix with permutation    " << radixIndexed / total << " ns/piece   " << indexed / radixIndexed
+              << "x" << std::endl;
+    std::cout << "mismatches: " << mismatches << std::endl;
+    return mismatches == 0 ? 0 : 1;
+}
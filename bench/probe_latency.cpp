@@ -0,0 +1,91 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file probe_latency.cpp
+ * @brief Benchmark: PerftTable probe latency with and without prefetching, across table sizes.
+ *
+ * Each step mimics a search node: the position key becomes known, some unrelated work runs
+ * (move generation on a fixed board), then the table is probed, and the probe result feeds the
+ * next key so no two probes can overlap on their own. With prefetching the bucket is requested
+ * as soon as the key is known, so the miss overlaps the work instead of following it.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O2 -std=c++17 -I. bench/probe_latency.cpp Perft.cpp Board.cpp HashMemory.cpp \
+ *         PieceRecord.cpp ChessPiece.cpp Pawn.cpp Rook.cpp -o probe_latency
+ *     ./probe_latency [max megabytes, default 1024]
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "Perft.hpp"
+#include "Random.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const int STEPS = 1 << 21;
+
+    Board workBoard() {
+        Board board;
+        for (int column = 0; column < ChessPiece::BOARD_LENGTH; column += 2) {
+            board.place(Pawn("white", 1, column, true, true));
+            board.place(Pawn("black", 6, column + 1, false, true));
+        }
+        board.place(Rook("white", 0, 0, true, 2));
+        board.place(Rook("white", 0, 7, true, 2));
+        board.place(Rook("black", 7, 0, false, 2));
+        board.place(Rook("black", 7, 7, false, 2));
+        return board;
+    }
+
+    std::uint64_t mix(std::uint64_t value) {
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+    // Returns nanoseconds per step; checksum keeps the compiler from dropping the probes
+    double run(const PerftTable &table, const Board &board, bool prefetch, std::uint64_t &checksum) {
+        std::uint64_t key = 0x1234567ULL;
+        Clock::time_point start = Clock::now();
+        for (int step = 0; step < STEPS; ++step) {
+            if (prefetch) {
+                table.prefetch(key);
+            }
+            MoveList moves;
+            board.generateMoves(moves);
+            std::uint64_t count = 0;
+            table.probe(key, 3, count);
+            key = mix(key + count + static_cast<std::uint64_t>(moves.size()));
+        }
+        checksum += key;
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / STEPS;
+    }
+}
+
+int main(int argc, char *argv[]) {
+    std::size_t maxMegabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1024;
+    const Board board = workBoard();
+    std::uint64_t checksum = 0;
+
+    std::cout << std::setw(10) << "table MB" << std::setw(14) << "plain ns" << std::setw(14) << "prefetch ns"
+              << std::setw(10) << "speedup" << std::endl;
+    for (std::size_t megabytes = 1; megabytes <= maxMegabytes; megabytes *= 4) {
+        PerftTable table(megabytes);
+        Random random(megabytes);
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            table.store(random.next(), 3, i);
+        }
+        run(table, board, false, checksum);    // Warm up
+        double plain = run(table, board, false, checksum);
+        double prefetched = run(table, board, true, checksum);
+        std::cout << std::setw(10) << megabytes << std::fixed << std::setprecision(1) << std::setw(14) << plain
+                  << std::setw(14) << prefetched << std::setprecision(2) << std::setw(10) << plain / prefetched
+                  << std::endl;
+    }
+    std::cout << "checksum " << checksum << std::endl;
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file startup_probe.cpp
+ * @brief The short-lived program timed by the startup suite (startup_suite.cpp). It does what a
+ *        one-shot command line invocation does, once each: construct pieces, parse a position,
+ *        answer canCastle / canPromote queries and print the pieces with display().
+ *
+ * When started by the suite it reports, on file descriptor 3, the nanoseconds from launch to main
+ * and spent in each stage, plus the page faults taken before and inside main. Run by hand, it
+ * prints the same report to stderr. The optional argument replaces the built-in position:
+ *     "<color> <piece|pawn|rook> <row> <column> <up|down> [double jump 0/1 | castle moves]; ..."
+ *
+ * Build from the repository root, eg. (add -static for a statically linked copy to compare)
+ *     g++ -O2 -std=c++17 -I. bench/startup_probe.cpp Board.cpp PieceRecord.cpp ChessPiece.cpp \
+ *         Pawn.cpp Rook.cpp -o startup_probe
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <vector>
+#include "Board.hpp"
+
+namespace {
+    const char *DEFAULT_POSITION =
+            "white rook 0 0 up 2; white pawn 0 1 up 0; white piece 0 4 up; white pawn 1 2 up 1; "
+            "white pawn 7 3 up 0; black rook 7 7 down 2; black pawn 7 6 down 0; black pawn 0 5 down 0; "
+            "black pawn 6 1 down 1; black piece 7 4 down";
+
+    std::int64_t now() {
+        timespec time;
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        return static_cast<std::int64_t>(time.tv_sec) * 1000000000 + time.tv_nsec;
+    }
+
+    long minorFaults() {
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_minflt;
+    }
+
+    struct Position {
+        Board board;
+        std::vector<ChessPiece> pieces;
+        std::vector<Pawn> pawns;
+        std::vector<Rook> rooks;
+    };
+
+    // Parses one "; " separated entry per piece; malformed entries are skipped
+    void parse(const std::string &text, Position &position) {
+        std::istringstream entries(text);
+        std::string entry;
+        while (std::getline(entries, entry, ';')) {
+            std::istringstream fields(entry);
+            std::string color;
+            std::string kind;
+            std::string direction;
+            int row = -1;
+            int column = -1;
+            int extra = 0;
+            if (!(fields >> color >> kind >> row >> column >> direction)) {
+                continue;
+            }
+            fields >> extra;
+            const bool up = direction == "up";
+            if (kind == "pawn") {
+                position.pawns.emplace_back(color, row, column, up, extra != 0);
+                position.board.place(position.pawns.back());
+            } else if (kind == "rook") {
+                position.rooks.emplace_back(color, row, column, up, extra);
+                position.board.place(position.rooks.back());
+            } else {
+                position.pieces.emplace_back(color, row, column, up);
+                position.board.place(position.pieces.back());
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const std::int64_t mainEntered = now();
+    const long faultsBeforeMain = minorFaults();
+    const char *launch = std::getenv("CHESS_STARTUP_LAUNCH_NS");
+
+    // Stage 1: construct pieces directly
+    std::int64_t stageStart = now();
+    std::vector<ChessPiece> built;
+    built.emplace_back("white", 3, 3, true);
+    built.emplace_back(Pawn("black", 6, 2, false, true));
+    built.emplace_back(Rook("white", 0, 0, true, 3));
+    const std::int64_t construct = now() - stageStart;
+
+    // Stage 2: parse a position
+    stageStart = now();
+    Position position;
+    parse(argc > 1 ? argv[1] : DEFAULT_POSITION, position);
+    const std::int64_t parsing = now() - stageStart;
+
+    // Stage 3: answer the queries
+    stageStart = now();
+    int castles = 0;
+    int promotions = 0;
+    for (const Rook &rook : position.rooks) {
+        for (const ChessPiece &piece : position.pieces) {
+            castles += rook.canCastle(piece);
+        }
+        for (const Pawn &pawn : position.pawns) {
+            castles += rook.canCastle(pawn);
+        }
+    }
+    for (const Pawn &pawn : position.pawns) {
+        promotions += pawn.canPromote();
+    }
+    const std::int64_t query = now() - stageStart;
+
+    // Stage 4: print
+    stageStart = now();
+    for (Rook &rook : position.rooks) {
+        rook.display();
+    }
+    for (Pawn &pawn : position.pawns) {
+        pawn.display();
+    }
+    for (ChessPiece &piece : position.pieces) {
+        piece.display();
+    }
+    std::cout << castles << " castles, " << promotions << " promotions" << std::endl;
+    const std::int64_t display = now() - stageStart;
+
+    const std::int64_t startToMain = launch != nullptr ? mainEntered - std::atoll(launch) : -1;
+    char report[256];
+    int length = std::snprintf(report, sizeof(report),
+                               "launch_to_main %lld construct %lld parse %lld query %lld display %lld "
+                               "main_to_exit %lld faults_before_main %ld faults_in_main %ld\n",
+                               static_cast<long long>(startToMain), static_cast<long long>(construct),
+                               static_cast<long long>(parsing), static_cast<long long>(query),
+                               static_cast<long long>(display), static_cast<long long>(now() - mainEntered),
+                               faultsBeforeMain, minorFaults() - faultsBeforeMain);
+    struct stat info;
+    std::FILE *out = fstat(3, &info) == 0 ? fdopen(3, "w") : stderr;
+    std::fwrite(report, 1, static_cast<std::size_t>(length), out);
+    std::fflush(out);
+    return 0;
+}
@@ -0,0 +1,166 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file startup_suite.cpp
+ * @brief Benchmark: startup and cold-path latency of a one-shot invocation.
+ *
+ * Launches startup_probe (or any binaries given) many times as fresh processes and reports the
+ * median and 90th percentile of every stage, from the moment of the spawn to the moment the exit
+ * is reaped: exec plus dynamic linking plus static initialization (launch to main), then the
+ * probe's construct, parse, query and display stages, then exit. Page faults are counted before
+ * and inside main. Each binary runs twice: with lazy symbol binding and with LD_BIND_NOW=1, so
+ * the cost of binding every symbol up front shows separately; a -static build of the probe
+ * shows what dynamic linking costs in total.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O2 -std=c++17 bench/startup_suite.cpp -o startup_suite
+ *     ./startup_suite 500 ./startup_probe ./startup_probe_static
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <fcntl.h>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <spawn.h>
+#include <sstream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+extern char **environ;
+
+namespace {
+    // Stages reported in nanoseconds, then counters
+    const char *TIMES[] = {"launch_to_main", "construct", "parse", "query", "display", "main_to_exit", "total"};
+    const char *COUNTS[] = {"faults_before_main", "faults_in_main", "faults_total"};
+
+    typedef std::map<std::string, std::vector<double>> Samples;
+
+    std::int64_t now() {
+        timespec time;
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        return static_cast<std::int64_t>(time.tv_sec) * 1000000000 + time.tv_nsec;
+    }
+
+    // Runs the binary once; returns false if it could not be run or did not report
+    bool runOnce(const std::string &binary, bool bindNow, Samples &samples) {
+        int report[2];
+        if (pipe(report) != 0) {
+            return false;
+        }
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_addopen(&actions, 1, "/dev/null", O_WRONLY, 0);
+        // The read end may itself be descriptor 3, so it is closed before the write end takes that number
+        posix_spawn_file_actions_addclose(&actions, report[0]);
+        posix_spawn_file_actions_adddup2(&actions, report[1], 3);
+
+        std::vector<std::string> variables;
+        for (char **variable = environ; *variable != nullptr; ++variable) {
+            std::string text = *variable;
+            if (text.rfind("LD_BIND_NOW=", 0) != 0 && text.rfind("CHESS_STARTUP_LAUNCH_NS=", 0) != 0) {
+                variables.push_back(text);
+            }
+        }
+        if (bindNow) {
+            variables.push_back("LD_BIND_NOW=1");
+        }
+        std::vector<char *> arguments = {const_cast<char *>(binary.c_str()), nullptr};
+
+        // The launch time is taken last, so building the environment is not counted
+        const std::int64_t launched = now();
+        variables.push_back("CHESS_STARTUP_LAUNCH_NS=" + std::to_string(launched));
+        std::vector<char *> environment;
+        for (std::string &variable : variables) {
+            environment.push_back(&variable[0]);
+        }
+        environment.push_back(nullptr);
+
+        pid_t pid;
+        int spawned = posix_spawn(&pid, binary.c_str(), &actions, nullptr, arguments.data(), environment.data());
+        posix_spawn_file_actions_destroy(&actions);
+        close(report[1]);
+        if (spawned != 0) {
+            close(report[0]);
+            return false;
+        }
+
+        std::string text;
+        char buffer[512];
+        ssize_t got;
+        while ((got = read(report[0], buffer, sizeof(buffer))) > 0) {
+            text.append(buffer, static_cast<std::size_t>(got));
+        }
+        close(report[0]);
+        int status = 0;
+        rusage usage;
+        wait4(pid, &status, 0, &usage);
+        const std::int64_t total = now() - launched;
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || text.empty()) {
+            return false;
+        }
+
+        std::istringstream fields(text);
+        std::string name;
+        double value;
+        while (fields >> name >> value) {
+            samples[name].push_back(value);
+        }
+        samples["total"].push_back(static_cast<double>(total));
+        samples["faults_total"].push_back(static_cast<double>(usage.ru_minflt));
+        return true;
+    }
+
+    double percentile(std::vector<double> values, double fraction) {
+        if (values.empty()) {
+            return 0;
+        }
+        std::sort(values.begin(), values.end());
+        return values[static_cast<std::size_t>(fraction * (values.size() - 1))];
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const int runs = argc > 1 ? std::atoi(argv[1]) : 200;
+    std::vector<std::string> binaries;
+    for (int i = 2; i < argc; ++i) {
+        binaries.push_back(argv[i]);
+    }
+    if (binaries.empty()) {
+        binaries.push_back("./startup_probe");
+    }
+
+    for (const std::string &binary : binaries) {
+        for (int bindNow = 0; bindNow < 2; ++bindNow) {
+            Samples samples;
+            int failures = 0;
+            for (int run = 0; run < runs; ++run) {
+                failures += !runOnce(binary, bindNow != 0, samples);
+            }
+
+            std::cout << binary << (bindNow ? " (LD_BIND_NOW=1)" : " (lazy binding)") << ", " << runs - failures
+                      << " runs" << std::endl;
+            std::cout << std::setw(22) << "stage" << std::setw(14) << "median us" << std::setw(14) << "p90 us"
+                      << std::endl;
+            for (const char *stage : TIMES) {
+                std::cout << std::setw(22) << stage << std::fixed << std::setprecision(1)
+                          << std::setw(14) << percentile(samples[stage], 0.5) / 1000
+                          << std::setw(14) << percentile(samples[stage], 0.9) / 1000 << std::endl;
+            }
+            for (const char *counter : COUNTS) {
+                std::cout << std::setw(22) << counter << std::setprecision(0)
+                          << std::setw(14) << percentile(samples[counter], 0.5)
+                          << std::setw(14) << percentile(samples[counter], 0.9) << std::endl;
+            }
+            std::cout << std::endl;
+        }
+    }
+    return 0;
+}
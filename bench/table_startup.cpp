@@ -0,0 +1,90 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file table_startup.cpp
+ * @brief Benchmark: what the move generation tables cost at startup.
+ *
+ * The tables are constexpr, so this program first checks a few entries with static_assert
+ * (which only compiles if the compiler computed them). The Zobrist keys are private to Board.cpp,
+ * so they are checked at run time instead: a static initializer of this file, which runs before
+ * those of Board.cpp when this file is linked first, keys a position, and main keys it again. Keys
+ * built by a dynamic initializer would still be zero the first time. It then measures:
+ *   - the first lookup in a fresh process, which only pays for faulting in read-only pages,
+ *   - the average lookup once warm,
+ *   - what building the tables at runtime would have cost, by calling the constexpr builder
+ *     through a volatile function pointer so the compiler cannot fold it.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O2 -std=c++17 -I. bench/table_startup.cpp Board.cpp PieceRecord.cpp \
+ *         ChessPiece.cpp Pawn.cpp Rook.cpp -o table_startup
+ *     ./table_startup
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include "BoardTables.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const int WARM_LOOKUPS = 1000000;
+    const int RUNTIME_BUILDS = 1000;
+
+    static_assert(BoardTables::TABLES.ray[BoardTables::UP][0] == 0x0101010101010100ULL, "a1 upward ray");
+    static_assert(BoardTables::TABLES.adjacent[0] == 0x2ULL, "a1 has one lateral neighbour");
+    static_assert(BoardTables::TABLES.pawnCapture[1][9] == 0x50000ULL, "b2 pawn moving up captures a3 and c3");
+    static_assert(BoardTables::TABLES.pawnPush[0][0] == 0, "a pawn on the first row moving down has no push");
+
+    double nanosecondsSince(Clock::time_point start) {
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    std::uint64_t sampleKey() {
+        Board board;
+        board.place(Rook("white", 0, 0, true, 3));
+        board.place(Pawn("black", 6, 4, false, true));
+        board.setSideToMove(Board::BLACK);
+        return board.key();
+    }
+
+    // Computed during static initialization, before main
+    const std::uint64_t EARLY_KEY = sampleKey();
+}
+
+int main() {
+    // The very first touch of the tables in this process (the clock is called once beforehand so
+    // resolving its symbol is not counted)
+    Clock::time_point start = Clock::now();
+    start = Clock::now();
+    Bitboard first = BoardTables::rookAttacks(27, BoardTables::TABLES.adjacent[27]);
+    double cold = nanosecondsSince(start);
+
+    Bitboard second = 0;
+    start = Clock::now();
+    for (int i = 0; i < WARM_LOOKUPS; ++i) {
+        second ^= BoardTables::rookAttacks(i % Board::SQUARES, second | BoardTables::TABLES.adjacent[i % Board::SQUARES]);
+    }
+    double warm = nanosecondsSince(start) / WARM_LOOKUPS;
+
+    BoardTables::Tables (*volatile build)() = &BoardTables::makeTables;
+    Bitboard checksum = first ^ second;
+    start = Clock::now();
+    for (int i = 0; i < RUNTIME_BUILDS; ++i) {
+        BoardTables::Tables tables = build();
+        checksum ^= tables.rook[i % Board::SQUARES];
+    }
+    double runtime = nanosecondsSince(start) / RUNTIME_BUILDS;
+
+    std::cout << "table size            " << sizeof(BoardTables::Tables) << " bytes (read-only data)" << std::endl;
+    const std::uint64_t key = sampleKey();
+    const bool constant = key != 0 && key == EARLY_KEY;
+    std::cout << "tables                 constant-initialized (checked by static_assert)" << std::endl;
+    std::cout << "Zobrist keys           " << (constant ? "constant-initialized" : "NOT ready before main")
+              << " (key before main " << EARLY_KEY << ", in main " << key << ")" << std::endl;
+    std::cout << "first lookup (cold)    " << cold << " ns" << std::endl;
+    std::cout << "later lookups (warm)   " << warm << " ns" << std::endl;
+    std::cout << "runtime build avoided  " << runtime << " ns" << std::endl;
+    std::cout << "checksum               " << checksum << std::endl;
+    return constant ? 0 : 1;
+}
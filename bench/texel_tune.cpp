@@ -0,0 +1,108 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file texel_tune.cpp
+ * @brief Benchmark: tuning evaluation weights with TexelTuner on positions labeled by a known
+ *        evaluation.
+ *
+ * Random positions with random material are scored with a hidden set of weights, and each one is
+ * labeled a WHITE win or loss with the probability the logistic model gives that score. Tuning
+ * from the default weights should then find the hidden ones again, up to sampling noise. Reports
+ * the time to load the positions, the time per gradient evaluation on the requested threads (run
+ * with 1 and with more to compare), and the tuned weights next to the hidden ones.
+ *
+ * Build and run from the repository root, eg.
+ *     g++ -O3 -march=native -std=c++17 -pthread -I. bench/texel_tune.cpp TexelTuner.cpp Features.cpp \
+ *         PositionGenerator.cpp PieceIndex.cpp Board.cpp PieceRecord.cpp ChessPiece.cpp Pawn.cpp Rook.cpp \
+ *         -o texel_tune
+ *     ./texel_tune [positions, default 1000000] [threads, default 0 for every hardware thread]
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "PositionGenerator.hpp"
+#include "TexelTuner.hpp"
+
+namespace {
+    typedef std::chrono::steady_clock Clock;
+
+    const int SPECS = 64;
+
+    double secondsSince(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+}
+
+int main(int argc, char *argv[]) {
+    const std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000;
+    const unsigned threads = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 0;
+
+    TexelTuner::Weights hidden;
+    hidden[Features::PAWNS] = 90;
+    hidden[Features::PAWN_ADVANCE] = 8;
+    hidden[Features::ROOKS] = 450;
+    hidden[Features::ROOK_MOBILITY] = 4;
+    hidden[Features::ROOK_OPEN_FILE] = 25;
+    hidden[Features::ROOK_HALF_OPEN_FILE] = 12;
+    hidden[Features::PIECES] = 250;
+
+    // Generators with assorted material, so every column varies between positions
+    Random random(23);
+    std::vector<std::unique_ptr<PositionGenerator>> generators;
+    for (int i = 0; i < SPECS; ++i) {
+        PositionGenerator::Spec spec;
+        for (int side = 0; side < 2; ++side) {
+            spec.pawns[side] = static_cast<int>(random.below(9));
+            spec.rooks[side] = static_cast<int>(random.below(3));
+            spec.pieces[side] = static_cast<int>(random.below(3));
+        }
+        generators.emplace_back(new PositionGenerator(spec, 29, static_cast<std::uint64_t>(i)));
+    }
+
+    TexelTuner::Options options;
+    options.threads = threads;
+    TexelTuner tuner(options);
+    tuner.reserve(count);
+    Clock::time_point start = Clock::now();
+    Board board;
+    std::int16_t row[Features::WIDTH];
+    while (tuner.size() < count) {
+        if (!generators[random.below(SPECS)]->next(board)) {
+            continue;
+        }
+        Features::extract(board, row);
+        double score = 0;
+        for (int j = 0; j < Features::COLUMNS; ++j) {
+            score += hidden[j] * (row[j] - row[Features::COLUMNS + j]);
+        }
+        const double probability = 1 / (1 + std::pow(10.0, -score / options.scale));
+        tuner.add(board, static_cast<double>(random.next() >> 11) / 9007199254740992.0 < probability ? 1 : 0);
+    }
+    const double loading = secondsSince(start);
+
+    const int evaluations = 20;
+    start = Clock::now();
+    for (int i = 0; i < evaluations; ++i) {
+        tuner.loss(TexelTuner::defaultWeights());
+    }
+    const double evaluation = secondsSince(start) / evaluations;
+
+    const TexelTuner::Report report = tuner.tune(TexelTuner::defaultWeights());
+
+    std::cout << count << " positions loaded in " << loading << " s" << std::endl;
+    std::cout << "loss evaluation  " << evaluation * 1e3 << " ms  (" << evaluation * 1e9 / count << " ns/position)"
+              << std::endl;
+    std::cout << "tuning           " << report.iterations << " iterations in " << report.seconds << " s, "
+              << (report.converged ? "converged" : "not converged") << ", loss " << report.startLoss << " -> "
+              << report.loss << std::endl;
+    std::cout << "tuned weights:" << std::endl;
+    TexelTuner::display(report.weights);
+    std::cout << "hidden weights:" << std::endl;
+    TexelTuner::display(hidden);
+    return 0;
+}
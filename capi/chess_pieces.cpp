@@ -0,0 +1,211 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file chess_pieces.cpp
+ * @brief This file contains the implementation of the C ABI declared in chess_pieces.h.
+ *
+ * chess_piece_t mirrors the layout of PieceRecord, but pieces are converted by value when they
+ * are read, so a C caller may pass any bytes in the flag fields.
+ * No exception is allowed to cross into C: the few calls that allocate catch everything.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "PieceRecord.hpp"
+#include "chess_pieces.h"
+
+namespace {
+    // The layout is kept identical to PieceRecord so the two stay easy to compare; nothing relies on it
+    static_assert(sizeof(chess_piece_t) == sizeof(PieceRecord), "chess_piece_t mirrors PieceRecord");
+    static_assert(offsetof(chess_piece_t, kind) == offsetof(PieceRecord, kind), "kind offset");
+    static_assert(offsetof(chess_piece_t, row) == offsetof(PieceRecord, row), "row offset");
+    static_assert(offsetof(chess_piece_t, column) == offsetof(PieceRecord, column), "column offset");
+    static_assert(offsetof(chess_piece_t, moving_up) == offsetof(PieceRecord, movingUp), "moving_up offset");
+    static_assert(offsetof(chess_piece_t, double_jumpable) == offsetof(PieceRecord, doubleJumpable),
+                  "double_jumpable offset");
+    static_assert(offsetof(chess_piece_t, color) == offsetof(PieceRecord, color), "color offset");
+    static_assert(offsetof(chess_piece_t, castle_moves_left) == offsetof(PieceRecord, castleMovesLeft),
+                  "castle_moves_left offset");
+    static_assert(CHESS_KIND_PAWN == static_cast<int>(PieceKind::PAWN)
+                  && CHESS_KIND_ROOK == static_cast<int>(PieceKind::ROOK), "kind values");
+
+    const int BOARD_LENGTH = ChessPiece::BOARD_LENGTH;
+
+    // Copies field by field: the flag bytes come from C unchecked, so they are tested against 0
+    // rather than read as bool, and the two structs are never accessed through each other
+    inline PieceRecord record(const chess_piece_t &piece) {
+        PieceRecord result;
+        result.kind = static_cast<PieceKind>(piece.kind);
+        result.row = piece.row;
+        result.column = piece.column;
+        result.movingUp = piece.moving_up != 0;
+        result.doubleJumpable = piece.double_jumpable != 0;
+        result.color = piece.color;
+        result.castleMovesLeft = piece.castle_moves_left;
+        return result;
+    }
+
+    inline bool onBoard(int value) {
+        return value >= 0 && value < BOARD_LENGTH;
+    }
+
+    // Same rule as ChessPiece::setColor / the constructors, minus the BLACK fallback
+    bool normalizeColor(const char *color, std::string &name) {
+        name.clear();
+        for (const char *c = color; *c != '\0'; ++c) {
+            if (!std::isalpha(static_cast<unsigned char>(*c))) {
+                return false;
+            }
+            name.push_back(static_cast<char>(std::toupper(static_cast<unsigned char>(*c))));
+        }
+        return true;
+    }
+
+    // Appends as much of text as fits, always counting its full length
+    void append(char *buffer, std::size_t capacity, std::size_t &length, const char *text, std::size_t size) {
+        if (buffer != nullptr && length < capacity) {
+            std::memcpy(buffer + length, text, std::min(size, capacity - length));
+        }
+        length += size;
+    }
+}
+
+uint32_t chess_abi_version(void) {
+    return CHESS_PIECES_ABI_VERSION;
+}
+
+uint16_t chess_color_id(const char *color) {
+    try {
+        std::string name;
+        if (color == nullptr || !normalizeColor(color, name)) {
+            return PieceRecord::BLACK;
+        }
+        return PieceRecord::colorId(name);
+    } catch (...) {
+        return PieceRecord::BLACK;
+    }
+}
+
+void chess_construct(chess_piece_t *out, size_t count, const uint8_t *kinds, const uint16_t *colors,
+                     const int32_t *rows, const int32_t *columns, const uint8_t *moving_up,
+                     const int32_t *extra) {
+    // Unknown color ids fall back to BLACK, as an invalid color name would
+    const std::size_t colorCount = PieceRecord::colorCount();
+    for (std::size_t i = 0; i < count; ++i) {
+        chess_piece_t &piece = out[i];
+        const bool placed = onBoard(rows[i]) && onBoard(columns[i]);
+        piece.kind = kinds[i] <= CHESS_KIND_ROOK ? kinds[i] : static_cast<uint8_t>(CHESS_KIND_PIECE);
+        piece.row = static_cast<int8_t>(placed ? rows[i] : -1);
+        piece.column = static_cast<int8_t>(placed ? columns[i] : -1);
+        piece.moving_up = moving_up[i] != 0;
+        piece.double_jumpable = piece.kind == CHESS_KIND_PAWN && extra != nullptr && extra[i] != 0;
+        piece.reserved = 0;
+        piece.color = colors[i] < colorCount ? colors[i] : PieceRecord::BLACK;
+        piece.castle_moves_left = 0;
+        if (piece.kind == CHESS_KIND_ROOK) {
+            piece.castle_moves_left = extra == nullptr ? 3 : (extra[i] > 0 ? extra[i] : 0);
+        }
+    }
+}
+
+size_t chess_validate(const chess_piece_t *pieces, size_t count, uint8_t *valid) {
+    const std::size_t colorCount = PieceRecord::colorCount();
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const chess_piece_t &piece = pieces[i];
+        // Off the board, setRow then setColumn can leave one coordinate -1 and the other on the board
+        const bool ok = piece.kind <= CHESS_KIND_ROOK
+                        && (onBoard(piece.row) || piece.row == -1)
+                        && (onBoard(piece.column) || piece.column == -1)
+                        && piece.moving_up <= 1
+                        && piece.double_jumpable <= 1
+                        && (piece.kind == CHESS_KIND_PAWN || piece.double_jumpable == 0)
+                        && piece.reserved == 0
+                        && piece.color < colorCount
+                        && piece.castle_moves_left >= 0
+                        && (piece.kind == CHESS_KIND_ROOK || piece.castle_moves_left == 0);
+        if (valid != nullptr) {
+            valid[i] = ok;
+        }
+        total += ok;
+    }
+    return total;
+}
+
+void chess_move(chess_piece_t *pieces, size_t count, const int32_t *rows, const int32_t *columns) {
+    for (std::size_t i = 0; i < count; ++i) {
+        chess_piece_t &piece = pieces[i];
+        // setRow: an out-of-bounds row takes the piece off the board
+        if (onBoard(rows[i])) {
+            piece.row = static_cast<int8_t>(rows[i]);
+        } else {
+            piece.row = -1;
+            piece.column = -1;
+        }
+        // setColumn: same rule for the column
+        if (onBoard(columns[i])) {
+            piece.column = static_cast<int8_t>(columns[i]);
+        } else {
+            piece.row = -1;
+            piece.column = -1;
+        }
+    }
+}
+
+void chess_can_promote(const chess_piece_t *pieces, size_t count, uint8_t *out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = record(pieces[i]).canPromote();
+    }
+}
+
+void chess_can_castle(const chess_piece_t *rooks, const chess_piece_t *partners, size_t count, uint8_t *out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = record(rooks[i]).canCastle(record(partners[i]));
+    }
+}
+
+size_t chess_format(const chess_piece_t *pieces, size_t count, char *buffer, size_t capacity) {
+    try {
+        // Color names are looked up once per id rather than once per piece
+        std::vector<std::string> names;
+        std::vector<bool> known;
+        std::size_t length = 0;
+        char line[64];
+        for (std::size_t i = 0; i < count; ++i) {
+            const chess_piece_t &piece = pieces[i];
+            if (piece.color >= names.size()) {
+                names.resize(piece.color + 1u);
+                known.resize(piece.color + 1u, false);
+            }
+            if (!known[piece.color]) {
+                names[piece.color] = PieceRecord::colorName(piece.color);
+                known[piece.color] = true;
+            }
+            const std::string &name = names[piece.color];
+            append(buffer, capacity, length, name.data(), name.size());
+
+            int size;
+            if (piece.row != -1 && piece.column != -1) {
+                size = std::snprintf(line, sizeof(line), " piece at (%d,%d) is moving %s\n",
+                                     piece.row, piece.column, piece.moving_up ? "UP" : "DOWN");
+            } else {
+                size = std::snprintf(line, sizeof(line), " piece is not on the board\n");
+            }
+            append(buffer, capacity, length, line, static_cast<std::size_t>(size));
+        }
+        if (buffer != nullptr && capacity > 0) {
+            buffer[length < capacity ? length : capacity - 1] = '\0';
+        }
+        return length;
+    } catch (...) {
+        if (buffer != nullptr && capacity > 0) {
+            buffer[0] = '\0';
+        }
+        return 0;
+    }
+}
@@ -0,0 +1,130 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file chess_pieces.h
+ * @brief Stable C ABI for the piece logic, built as a shared library.
+ *
+ * Every entry point works on an array of chess_piece_t, so the cost of crossing a foreign
+ * function interface is paid once per batch instead of once per piece. chess_piece_t has the
+ * same layout as the library's PieceRecord, and the rules applied are exactly those of the
+ * ChessPiece, Pawn and Rook classes.
+ *
+ * The layout of chess_piece_t and the meaning of every function are frozen for a given
+ * CHESS_PIECES_ABI_VERSION; new functions may be added without changing it.
+ *
+ * Build it together with the library sources, eg.
+ *     g++ -O2 -shared -fPIC -fvisibility=hidden -std=c++17 -I.. chess_pieces.cpp \
+ *         ../PieceRecord.cpp ../ChessPiece.cpp ../Pawn.cpp ../Rook.cpp -o libchesspieces.so
+ */
+
+#ifndef CHESS_PIECES_H
+#define CHESS_PIECES_H
+
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define CHESS_API __declspec(dllexport)
+#else
+#define CHESS_API __attribute__((visibility("default")))
+#endif
+
+#define CHESS_PIECES_ABI_VERSION 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+    CHESS_KIND_PIECE = 0,
+    CHESS_KIND_PAWN = 1,
+    CHESS_KIND_ROOK = 2
+};
+
+typedef struct chess_piece_t {
+    uint8_t kind;                   /* One of CHESS_KIND_* */
+    int8_t row;                     /* -1 if the piece is not on the board */
+    int8_t column;                  /* -1 if the piece is not on the board */
+    uint8_t moving_up;              /* 0 or 1 */
+    uint8_t double_jumpable;        /* 0 or 1, pawns only */
+    uint8_t reserved;               /* Always 0 */
+    uint16_t color;                 /* Color id, see chess_color_id() */
+    int32_t castle_moves_left;      /* Rooks only */
+} chess_piece_t;
+
+/**
+ * @return The CHESS_PIECES_ABI_VERSION the library was built with
+ */
+CHESS_API uint32_t chess_abi_version(void);
+
+/**
+ * @brief Gets the id of a color name, registering it on first use. WHITE is 0 and BLACK is 1.
+ * @param color A NUL terminated color name; it is validated and upper-cased like ChessPiece::setColor
+ * @return The color id, or the id of BLACK if the name is not purely alphabetic
+ */
+CHESS_API uint16_t chess_color_id(const char *color);
+
+/**
+ * @brief Constructs pieces with the rules of the ChessPiece, Pawn and Rook constructors.
+ * @param out The array that receives count pieces
+ * @param count The number of pieces
+ * @param kinds, colors, rows, columns, moving_up One entry per piece. colors holds color ids.
+ * @param extra One entry per piece, or NULL: double jump flags for pawns, castle moves for rooks
+ *        (when NULL, pawns cannot double jump and rooks get 3 castle moves, as in the default constructors)
+ */
+CHESS_API void chess_construct(chess_piece_t *out, size_t count, const uint8_t *kinds, const uint16_t *colors,
+                               const int32_t *rows, const int32_t *columns, const uint8_t *moving_up,
+                               const int32_t *extra);
+
+/**
+ * @brief Checks that pieces hold states the classes could be in (a known kind, each coordinate
+ *        on the board or -1, no negative castle moves, no double jump flag on non-pawns).
+ *        A piece with either coordinate -1 is off the board; one coordinate may still be on the
+ *        board, as chess_move and ChessPiece::setRow followed by setColumn can leave it.
+ * @param pieces, count The pieces to check
+ * @param valid Receives 1 per valid piece and 0 per invalid one; may be NULL
+ * @return The number of valid pieces
+ */
+CHESS_API size_t chess_validate(const chess_piece_t *pieces, size_t count, uint8_t *valid);
+
+/**
+ * @brief Moves pieces with the rules of ChessPiece::setRow followed by ChessPiece::setColumn
+ *        (an out-of-bounds value takes the piece off the board). Like the classes, a bad row
+ *        followed by a good column leaves the piece at (-1, column), which chess_validate accepts.
+ * @param pieces, count The pieces to move
+ * @param rows, columns One destination per piece
+ */
+CHESS_API void chess_move(chess_piece_t *pieces, size_t count, const int32_t *rows, const int32_t *columns);
+
+/**
+ * @brief Evaluates Pawn::canPromote for every piece (always 0 for non-pawns).
+ * @param pieces, count The pieces to check
+ * @param out Receives one 0 / 1 flag per piece
+ */
+CHESS_API void chess_can_promote(const chess_piece_t *pieces, size_t count, uint8_t *out);
+
+/**
+ * @brief Evaluates rooks[i].canCastle(partners[i]) for every i (always 0 when rooks[i] is not a rook).
+ * @param rooks, partners, count The pairs to check
+ * @param out Receives one 0 / 1 flag per pair
+ */
+CHESS_API void chess_can_castle(const chess_piece_t *rooks, const chess_piece_t *partners, size_t count,
+                                uint8_t *out);
+
+/**
+ * @brief Formats pieces the way ChessPiece::display prints them, one line per piece, each
+ *        ending in '\n'. The text is NUL terminated when it fits.
+ * @param pieces, count The pieces to format
+ * @param buffer The destination, or NULL to only measure
+ * @param capacity The size of buffer in bytes
+ * @return The number of bytes the full text needs, excluding the NUL (like snprintf)
+ */
+CHESS_API size_t chess_format(const chess_piece_t *pieces, size_t count, char *buffer, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+
+#endif /* CHESS_PIECES_H */
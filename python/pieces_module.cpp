@@ -0,0 +1,347 @@
+/**
+ * @Name: Farhana Sultana
+ * @Date: 10/17/2026
+ * @file pieces_module.cpp
+ * @brief CPython extension module "chesspieces": batch access to the piece logic over contiguous
+ *        PieceRecord arrays, without copying them.
+ *
+ * Piece arrays cross the language boundary through the buffer protocol. A PieceArray owns a block
+ * of PieceRecords and exports it with a structured format, so numpy.asarray(PieceArray(n)) is a
+ * writable record array over the same memory (fields kind, row, column, movingUp, doubleJumpable,
+ * color, castleMovesLeft). The batch functions accept any aligned buffer of records (a PieceArray,
+ * a numpy array with that layout, a bytearray, ...) whose format is RECORD_FORMAT or plain bytes,
+ * and release the GIL while they loop.
+ *
+ * Build it together with the library sources, eg.
+ *     g++ -O2 -shared -fPIC -std=c++17 -I.. $(python3-config --includes) pieces_module.cpp \
+ *         ../PieceRecord.cpp ../CastleJoin.cpp ../PieceOrder.cpp ../ChessPiece.cpp ../Pawn.cpp ../Rook.cpp \
+ *         -o chesspieces$(python3-config --extension-suffix)
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
+#include "CastleJoin.hpp"
+#include "PieceRecord.hpp"
+
+namespace {
+    // PEP 3118 description of PieceRecord; the explicit pad byte keeps it in step with the struct
+    char RECORD_FORMAT[] = "T{B:kind:b:row:b:column:?:movingUp:?:doubleJumpable:xH:color:i:castleMovesLeft:}";
+
+    static_assert(sizeof(PieceRecord) == 12, "RECORD_FORMAT describes a 12 byte record");
+    static_assert(offsetof(PieceRecord, color) == 6, "RECORD_FORMAT puts color at offset 6");
+    static_assert(offsetof(PieceRecord, castleMovesLeft) == 8, "RECORD_FORMAT puts castleMovesLeft at offset 8");
+
+    struct PieceArrayObject {
+        PyObject_HEAD
+        std::vector<PieceRecord> *records;
+        Py_ssize_t shape[1];
+        Py_ssize_t strides[1];
+    };
+
+    PyObject *pieceArrayNew(PyTypeObject *type, PyObject *args, PyObject *) {
+        Py_ssize_t count = 0;
+        if (!PyArg_ParseTuple(args, "n", &count)) {
+            return nullptr;
+        }
+        if (count < 0) {
+            PyErr_SetString(PyExc_ValueError, "PieceArray size must not be negative");
+            return nullptr;
+        }
+        PieceArrayObject *self = reinterpret_cast<PieceArrayObject *>(type->tp_alloc(type, 0));
+        if (self == nullptr) {
+            return nullptr;
+        }
+        self->records = new(std::nothrow) std::vector<PieceRecord>();
+        if (self->records == nullptr) {
+            Py_DECREF(self);
+            return PyErr_NoMemory();
+        }
+        self->records->resize(static_cast<std::size_t>(count));
+        return reinterpret_cast<PyObject *>(self);
+    }
+
+    void pieceArrayDealloc(PyObject *object) {
+        PieceArrayObject *self = reinterpret_cast<PieceArrayObject *>(object);
+        delete self->records;
+        Py_TYPE(object)->tp_free(object);
+    }
+
+    Py_ssize_t pieceArrayLength(PyObject *object) {
+        return static_cast<Py_ssize_t>(reinterpret_cast<PieceArrayObject *>(object)->records->size());
+    }
+
+    int pieceArrayGetBuffer(PyObject *object, Py_buffer *view, int flags) {
+        PieceArrayObject *self = reinterpret_cast<PieceArrayObject *>(object);
+        self->shape[0] = static_cast<Py_ssize_t>(self->records->size());
+        self->strides[0] = sizeof(PieceRecord);
+
+        view->obj = object;
+        Py_INCREF(object);
+        view->buf = self->records->data();
+        view->len = self->shape[0] * static_cast<Py_ssize_t>(sizeof(PieceRecord));
+        view->readonly = 0;
+        view->itemsize = sizeof(PieceRecord);
+        view->format = (flags & PyBUF_FORMAT) ? RECORD_FORMAT : nullptr;
+        view->ndim = 1;
+        view->shape = (flags & PyBUF_ND) ? self->shape : nullptr;
+        view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? self->strides : nullptr;
+        view->suboffsets = nullptr;
+        view->internal = nullptr;
+        return 0;
+    }
+
+    // The slots are filled in PyInit_chesspieces. The array never resizes, so nothing needs to
+    // happen when a view is released.
+    PySequenceMethods pieceArraySequence{};
+    PyBufferProcs pieceArrayBuffer{};
+    PyTypeObject PieceArrayType{};
+
+    // Formats a record buffer may declare: the record itself, or raw bytes
+    bool recordFormat(const char *format, Py_ssize_t itemsize) {
+        if (format == nullptr) {
+            return itemsize == 1 || itemsize == static_cast<Py_ssize_t>(sizeof(PieceRecord));
+        }
+        if (std::strcmp(format, RECORD_FORMAT) == 0) {
+            return itemsize == static_cast<Py_ssize_t>(sizeof(PieceRecord));
+        }
+        return itemsize == 1 && (std::strcmp(format, "B") == 0 || std::strcmp(format, "b") == 0);
+    }
+
+    // True if every movingUp and doubleJumpable byte holds 0 or 1, so the records can be read in place
+    bool canonicalFlags(const unsigned char *bytes, std::size_t count) {
+        unsigned char other = 0;
+        for (std::size_t i = 0; i < count; ++i, bytes += sizeof(PieceRecord)) {
+            other |= bytes[offsetof(PieceRecord, movingUp)] | bytes[offsetof(PieceRecord, doubleJumpable)];
+        }
+        return (other & ~1) == 0;
+    }
+
+    // Borrows a contiguous, aligned buffer of PieceRecords from any exporter. Flag bytes other
+    // than 0 and 1 are not valid bools, so such a buffer is converted by value into copy (any
+    // nonzero byte is true) and records points there instead.
+    bool borrowRecords(PyObject *object, Py_buffer &view, const PieceRecord *&records, std::size_t &count,
+                       std::vector<PieceRecord> &copy) {
+        if (PyObject_GetBuffer(object, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+            return false;
+        }
+        if (view.len % static_cast<Py_ssize_t>(sizeof(PieceRecord)) != 0 || !recordFormat(view.format, view.itemsize)) {
+            PyBuffer_Release(&view);
+            PyErr_SetString(PyExc_ValueError, "buffer does not hold 12 byte piece records");
+            return false;
+        }
+        if (reinterpret_cast<std::uintptr_t>(view.buf) % alignof(PieceRecord) != 0) {
+            PyBuffer_Release(&view);
+            PyErr_SetString(PyExc_ValueError, "piece record buffer is not aligned");
+            return false;
+        }
+        const unsigned char *bytes = static_cast<const unsigned char *>(view.buf);
+        count = static_cast<std::size_t>(view.len) / sizeof(PieceRecord);
+        if (canonicalFlags(bytes, count)) {
+            records = static_cast<const PieceRecord *>(view.buf);
+            return true;
+        }
+        copy.resize(count);
+        for (std::size_t i = 0; i < count; ++i, bytes += sizeof(PieceRecord)) {
+            std::memcpy(&copy[i], bytes, sizeof(PieceRecord));
+            copy[i].movingUp = bytes[offsetof(PieceRecord, movingUp)] != 0;
+            copy[i].doubleJumpable = bytes[offsetof(PieceRecord, doubleJumpable)] != 0;
+        }
+        records = copy.data();
+        return true;
+    }
+
+    // Gets the output flags buffer: the caller's, or a new bytearray of the right size
+    PyObject *outputFlags(PyObject *out, std::size_t count, Py_buffer &view) {
+        if (out == nullptr || out == Py_None) {
+            out = PyByteArray_FromStringAndSize(nullptr, static_cast<Py_ssize_t>(count));
+        } else {
+            Py_INCREF(out);
+        }
+        if (out == nullptr) {
+            return nullptr;
+        }
+        if (PyObject_GetBuffer(out, &view, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE) != 0) {
+            Py_DECREF(out);
+            return nullptr;
+        }
+        if (view.len != static_cast<Py_ssize_t>(count)) {
+            PyBuffer_Release(&view);
+            Py_DECREF(out);
+            PyErr_SetString(PyExc_ValueError, "out must hold one byte per piece");
+            return nullptr;
+        }
+        return out;
+    }
+
+    PyObject *canPromote(PyObject *, PyObject *args, PyObject *kwargs) {
+        static const char *keywords[] = {"pieces", "out", nullptr};
+        PyObject *piecesObject = nullptr;
+        PyObject *outObject = nullptr;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|O", const_cast<char **>(keywords),
+                                         &piecesObject, &outObject)) {
+            return nullptr;
+        }
+
+        Py_buffer piecesView;
+        const PieceRecord *pieces;
+        std::size_t count;
+        std::vector<PieceRecord> piecesCopy;
+        if (!borrowRecords(piecesObject, piecesView, pieces, count, piecesCopy)) {
+            return nullptr;
+        }
+        Py_buffer outView;
+        PyObject *out = outputFlags(outObject, count, outView);
+        if (out == nullptr) {
+            PyBuffer_Release(&piecesView);
+            return nullptr;
+        }
+
+        unsigned char *flags = static_cast<unsigned char *>(outView.buf);
+        Py_BEGIN_ALLOW_THREADS
+        for (std::size_t i = 0; i < count; ++i) {
+            flags[i] = pieces[i].canPromote() ? 1 : 0;
+        }
+        Py_END_ALLOW_THREADS
+
+        PyBuffer_Release(&outView);
+        PyBuffer_Release(&piecesView);
+        return out;
+    }
+
+    PyObject *canCastle(PyObject *, PyObject *args, PyObject *kwargs) {
+        static const char *keywords[] = {"rooks", "partners", "out", nullptr};
+        PyObject *rooksObject = nullptr;
+        PyObject *partnersObject = nullptr;
+        PyObject *outObject = nullptr;
+        if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|O", const_cast<char **>(keywords),
+                                         &rooksObject, &partnersObject, &outObject)) {
+            return nullptr;
+        }
+
+        Py_buffer rooksView;
+        Py_buffer partnersView;
+        const PieceRecord *rooks;
+        const PieceRecord *partners;
+        std::size_t count;
+        std::size_t partnerCount;
+        std::vector<PieceRecord> rooksCopy;
+        std::vector<PieceRecord> partnersCopy;
+        if (!borrowRecords(rooksObject, rooksView, rooks, count, rooksCopy)) {
+            return nullptr;
+        }
+        if (!borrowRecords(partnersObject, partnersView, partners, partnerCount, partnersCopy)) {
+            PyBuffer_Release(&rooksView);
+            return nullptr;
+        }
+        if (partnerCount != count) {
+            PyBuffer_Release(&partnersView);
+            PyBuffer_Release(&rooksView);
+            PyErr_SetString(PyExc_ValueError, "rooks and partners must have the same length");
+            return nullptr;
+        }
+        Py_buffer outView;
+        PyObject *out = outputFlags(outObject, count, outView);
+        if (out == nullptr) {
+            PyBuffer_Release(&partnersView);
+            PyBuffer_Release(&rooksView);
+            return nullptr;
+        }
+
+        unsigned char *flags = static_cast<unsigned char *>(outView.buf);
+        Py_BEGIN_ALLOW_THREADS
+        for (std::size_t i = 0; i < count; ++i) {
+            flags[i] = rooks[i].canCastle(partners[i]) ? 1 : 0;
+        }
+        Py_END_ALLOW_THREADS
+
+        PyBuffer_Release(&outView);
+        PyBuffer_Release(&partnersView);
+        PyBuffer_Release(&rooksView);
+        return out;
+    }
+
+    PyObject *castlePairs(PyObject *, PyObject *args) {
+        PyObject *piecesObject = nullptr;
+        if (!PyArg_ParseTuple(args, "O", &piecesObject)) {
+            return nullptr;
+        }
+        Py_buffer piecesView;
+        const PieceRecord *pieces;
+        std::size_t count;
+        std::vector<PieceRecord> piecesCopy;
+        if (!borrowRecords(piecesObject, piecesView, pieces, count, piecesCopy)) {
+            return nullptr;
+        }
+
+        std::vector<CastlePair> pairs;
+        Py_BEGIN_ALLOW_THREADS
+        pairs = CastleJoin::findPairs(pieces, count);
+        Py_END_ALLOW_THREADS
+        PyBuffer_Release(&piecesView);
+
+        // Returned as 2 * n unsigned 64 bit integers: numpy.frombuffer(result, numpy.uint64).reshape(-1, 2)
+        std::vector<unsigned long long> flat(pairs.size() * 2);
+        for (std::size_t i = 0; i < pairs.size(); ++i) {
+            flat[2 * i] = pairs[i].rook;
+            flat[2 * i + 1] = pairs[i].partner;
+        }
+        return PyByteArray_FromStringAndSize(reinterpret_cast<const char *>(flat.data()),
+                                             static_cast<Py_ssize_t>(flat.size() * sizeof(unsigned long long)));
+    }
+
+    PyMethodDef methods[] = {
+        {"can_promote", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(canPromote)),
+         METH_VARARGS | METH_KEYWORDS,
+         "can_promote(pieces, out=None) -> one byte per piece, 1 where Pawn::canPromote holds"},
+        {"can_castle", reinterpret_cast<PyCFunction>(reinterpret_cast<void (*)()>(canCastle)),
+         METH_VARARGS | METH_KEYWORDS,
+         "can_castle(rooks, partners, out=None) -> one byte per pair, 1 where rooks[i] can castle with partners[i]"},
+        {"castle_pairs", castlePairs, METH_VARARGS,
+         "castle_pairs(pieces) -> bytearray of (rook, partner) uint64 index pairs, see CastleJoin::findPairs"},
+        {nullptr, nullptr, 0, nullptr}
+    };
+
+    PyModuleDef module{};
+}
+
+PyMODINIT_FUNC PyInit_chesspieces() {
+    pieceArraySequence.sq_length = pieceArrayLength;
+    pieceArrayBuffer.bf_getbuffer = pieceArrayGetBuffer;
+    PieceArrayType.ob_base = PyVarObject{PyObject_HEAD_INIT(nullptr) 0};
+    PieceArrayType.tp_name = "chesspieces.PieceArray";
+    PieceArrayType.tp_basicsize = sizeof(PieceArrayObject);
+    PieceArrayType.tp_flags = Py_TPFLAGS_DEFAULT;
+    PieceArrayType.tp_doc = "PieceArray(n): n contiguous piece records exported through the buffer protocol";
+    PieceArrayType.tp_new = pieceArrayNew;
+    PieceArrayType.tp_dealloc = pieceArrayDealloc;
+    PieceArrayType.tp_as_sequence = &pieceArraySequence;
+    PieceArrayType.tp_as_buffer = &pieceArrayBuffer;
+    if (PyType_Ready(&PieceArrayType) < 0) {
+        return nullptr;
+    }
+
+    module.m_base = PyModuleDef_HEAD_INIT;
+    module.m_name = "chesspieces";
+    module.m_doc = "Batch piece logic over contiguous PieceRecord buffers.";
+    module.m_size = -1;
+    module.m_methods = methods;
+    PyObject *result = PyModule_Create(&module);
+    if (result == nullptr) {
+        return nullptr;
+    }
+    Py_INCREF(&PieceArrayType);
+    if (PyModule_AddObject(result, "PieceArray", reinterpret_cast<PyObject *>(&PieceArrayType)) < 0
+        || PyModule_AddStringConstant(result, "RECORD_FORMAT", RECORD_FORMAT) < 0
+        || PyModule_AddIntConstant(result, "RECORD_SIZE", sizeof(PieceRecord)) < 0) {
+        Py_DECREF(&PieceArrayType);
+        Py_DECREF(result);
+        return nullptr;
+    }
+    return result;
+}